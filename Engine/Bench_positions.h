@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "Training_data.h"
+
+using namespace std;
+
+//  bench_position -    :    
+// (   Training_data)   ,  
+struct bench_position
+{
+    const char* cells;
+    bool color;
+
+    //      Board
+    vector<vector<POS_T>> to_matrix() const
+    {
+        labeled_position pos;
+        for (int k = 0; k < 32; ++k)
+            pos.cells[k] = POS_T(cells[k] - '0');
+        return Training_data::to_matrix(pos);
+    }
+};
+
+//    :  , ,   
+//       (     )
+inline const vector<bench_position> Bench_positions = {
+    { "22222222222200000000111111111111", 0 },
+    { "22222022222000200120111011011111", 1 },
+    { "22222222202202001000101110111111", 0 },
+    { "20222220002020020000110111001010", 1 },
+    { "22220020000020002000100111001111", 0 },
+    { "00022200000200200000210111011100", 1 },
+    { "20022200200200200000001100001101", 1 },
+    { "00022202000021000003010100001010", 0 },
+    { "00200202002120000041010000010000", 1 },
+    { "20220002000000000001100000101040", 1 },
+    { "00000200220010000000130001011000", 1 },
+    { "00220100000000020001101010000000", 1 },
+    { "00020020002010200022010000000000", 0 },
+    { "30000000000000000101000000004000", 1 },
+    { "00000100000200000000020000000010", 0 },
+    { "00000000030000000000000000000400", 0 },
+};
@@ -0,0 +1,126 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "Logic.h"
+#include "Zobrist.h"
+
+// ,            ,  :
+//       
+const double Book_random_margin = 0.05;
+
+//     (    ) 
+const double Book_win = 100;
+
+//  book_entry     
+struct book_entry
+{
+    //      ,    
+    // (  ,    -   )
+    double value = 0;
+
+    //    (     )
+    bool expanded = false;
+};
+
+//  Book   :  ,   ,
+//       ,      .
+class Book
+{
+public:
+    //  load     path.  false,   .
+    //  :     -  (hex),    .
+    bool load(const string& path)
+    {
+        ifstream fin(path);
+        if (!fin.is_open())
+            return false;
+        uint64_t key;
+        bool expanded;
+        double value;
+        while (fin >> hex >> key >> dec >> expanded >> value)
+        {
+            entries[key] = { value, expanded };
+        }
+        fin.close();
+        return true;
+    }
+
+    //  save     path.     ,
+    //   ,      .
+    bool save(const string& path) const
+    {
+        const string tmp_path = path + ".tmp";
+        ofstream fout(tmp_path, ios_base::trunc);
+        if (!fout.is_open())
+            return false;
+        for (const auto& [key, entry] : entries)
+        {
+            fout << hex << key << dec << ' ' << entry.expanded << ' ' << entry.value << '\n';
+        }
+        fout.close();
+        remove(path.c_str());
+        return rename(tmp_path.c_str(), path.c_str()) == 0;
+    }
+
+    //  probe       color   mtx
+    //   ,      .
+    //    rand_eng,          Book_random_margin.
+    vector<move_pos> probe(const vector<vector<POS_T>>& mtx, const bool color, Logic& logic,
+                           default_random_engine* rand_eng = nullptr) const
+    {
+        auto it = entries.find(Zobrist::hash(mtx, color));
+        if (it == entries.end() || !it->second.expanded)
+            return {};
+
+        vector<pair<double, vector<move_pos>>> turns;
+        double best_value = -Book_win - 1;
+        for (const auto& turn : logic.find_full_turns(mtx, color))
+        {
+            auto child = entries.find(Zobrist::hash(apply(mtx, turn, logic), 1 - color));
+            if (child == entries.end())
+                continue;
+
+            //       ,   
+            turns.emplace_back(-child->second.value, turn);
+            best_value = max(best_value, turns.back().first);
+        }
+        vector<vector<move_pos>> candidates;
+        for (auto& [value, turn] : turns)
+        {
+            if (rand_eng ? value >= best_value - Book_random_margin : value == best_value)
+                candidates.push_back(move(turn));
+        }
+        if (candidates.empty())
+            return {};
+        return rand_eng ? candidates[(*rand_eng)() % candidates.size()] : candidates[0];
+    }
+
+    //  apply    mtx   turn (   )
+    static vector<vector<POS_T>> apply(vector<vector<POS_T>> mtx, const vector<move_pos>& turn, const Logic& logic)
+    {
+        for (const auto& step : turn)
+            mtx = logic.make_turn(mtx, step);
+        return mtx;
+    }
+
+    //  to_value   Logic ( ,  0  INF)
+    //   ,         
+    static double to_value(const double score)
+    {
+        if (score >= INF)
+            return Book_win;
+        if (score <= 0)
+            return -Book_win;
+        return log(score);
+    }
+
+public:
+    //      (  ,  )
+    unordered_map<uint64_t, book_entry> entries;
+};
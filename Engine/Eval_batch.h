@@ -0,0 +1,46 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+
+#include "State.h"
+
+using namespace std;
+
+//  eval_batch -       .
+//      (    ),
+//         .
+struct eval_batch
+{
+    //  clear   (  )
+    void clear()
+    {
+        size = 0;
+    }
+
+    //  push      st
+    void push(const board_state& st)
+    {
+        if (size == w.size())
+        {
+            const size_t capacity = max<size_t>(32, 2 * size);
+            for (auto* v : { &w, &wq, &b, &bq, &w_adv, &b_adv, &scores })
+                v->resize(capacity);
+        }
+        w[size] = st.w;
+        wq[size] = st.wq;
+        b[size] = st.b;
+        bq[size] = st.bq;
+        w_adv[size] = st.w_adv;
+        b_adv[size] = st.b_adv;
+        ++size;
+    }
+
+    //     (  board_state)    
+    vector<double> w, wq, b, bq, w_adv, b_adv;
+
+    //  ,    
+    vector<double> scores;
+
+    //    
+    size_t size = 0;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+using namespace std;
+
+//  Eval_cache -         .
+//         ( XOR ),  
+//       : , 
+//   ,        .
+class Eval_cache
+{
+public:
+    //       size_mb 
+    // (      )
+    explicit Eval_cache(const size_t size_mb)
+    {
+        size_t count = 1;
+        while (count * 2 * sizeof(entry) <= size_mb * 1024 * 1024)
+            count *= 2;
+        table = make_unique<entry[]>(count);
+        mask = count - 1;
+    }
+
+    //  probe      key.  true  .
+    bool probe(const uint64_t key, double& score) const
+    {
+        const entry& e = table[key & mask];
+        const uint64_t data = e.data.load(memory_order_relaxed);
+        if ((e.check.load(memory_order_relaxed) ^ data) != key)
+            return false;
+        memcpy(&score, &data, sizeof(score));
+        return true;
+    }
+
+    //  store      key,   
+    void store(const uint64_t key, const double score)
+    {
+        entry& e = table[key & mask];
+        uint64_t data;
+        memcpy(&data, &score, sizeof(data));
+        e.check.store(key ^ data, memory_order_relaxed);
+        e.data.store(data, memory_order_relaxed);
+    }
+
+    //    
+    size_t size() const
+    {
+        return mask + 1;
+    }
+
+    //  fill     (   )
+    double fill() const
+    {
+        size_t used = 0;
+        for (size_t i = 0; i <= mask; ++i)
+            used += (table[i].check.load(memory_order_relaxed) != 0 || table[i].data.load(memory_order_relaxed) != 0);
+        return double(used) / size();
+    }
+
+private:
+    //  :     ( double)
+    struct entry
+    {
+        atomic<uint64_t> check{ 0 };
+        atomic<uint64_t> data{ 0 };
+    };
+
+    unique_ptr<entry[]> table;
+    size_t mask;
+};
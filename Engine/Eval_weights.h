@@ -0,0 +1,50 @@
+#pragma once
+#include <fstream>
+#include <string>
+
+using namespace std;
+
+//  eval_weights -   "NumberAndPotential":
+//             .
+//       ,      .
+struct eval_weights
+{
+    //  load      path ( " ").
+    //   ,     .
+    //  false,   .
+    bool load(const string& path)
+    {
+        ifstream fin(path);
+        if (!fin.is_open())
+            return false;
+        string name;
+        double value;
+        while (fin >> name >> value)
+        {
+            if (name == "king")
+                king = value;
+            else if (name == "advance")
+                advance = value;
+        }
+        fin.close();
+        return true;
+    }
+
+    //  save     path   load
+    bool save(const string& path) const
+    {
+        ofstream fout(path, ios_base::trunc);
+        if (!fout.is_open())
+            return false;
+        fout.precision(10);
+        fout << "king " << king << '\n' << "advance " << advance << '\n';
+        fout.close();
+        return bool(fout);
+    }
+
+    //  
+    double king = 5;
+
+    //        
+    double advance = 0.05;
+};
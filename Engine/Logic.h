@@ -0,0 +1,922 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+#include "../Models/Bot_modes.h"
+#include "../Models/Move.h"
+#include "Eval_batch.h"
+#include "Eval_cache.h"
+#include "Eval_weights.h"
+#include "Nnue.h"
+#include "Patterns.h"
+#include "Settings.h"
+#include "State.h"
+#include "Trace.h"
+#include "Transposition_table.h"
+#include "Zobrist.h"
+
+// ,  "" (    )
+const int INF = 1e9;
+
+//  Logic         
+//     - 
+class Logic
+{
+    //  (Tools/Microbench.cpp)         
+    friend class Microbench;
+
+public:
+    //    
+    //        
+    explicit Logic(const engine_settings& settings)
+    {
+        //   "NoRandom" ,    
+        //    ,    
+        rand_eng = std::default_random_engine(!settings.no_random ? unsigned(time(0)) : 0);
+
+        //   (, "NumberAndPotential")    ,
+        //     
+        scoring_mode = settings.scoring_type;
+
+        //   (, "O0", "O1"  ..)
+        optimization = settings.optimization;
+
+        //         .
+        //     ,       "NumberAndPotential".
+        if (scoring_mode == BotScoringType::Network)
+        {
+            network = make_shared<Nnue>();
+            if (!network->load(settings.network_path))
+            {
+                network.reset();
+                scoring_mode = BotScoringType::NumberAndPotential;
+            }
+        }
+
+        //   "NumberAndPotential",  .   ,    .
+        if (scoring_mode == BotScoringType::NumberAndPotential)
+            weights.load(settings.weights_path);
+
+        //     ,    ,    
+        if (scoring_mode == BotScoringType::Patterns)
+        {
+            patterns = make_shared<Patterns>();
+            patterns->load(settings.patterns_path);
+        }
+
+        //       (0 -  )
+        if (settings.eval_cache_mb)
+            eval_cache = make_shared<Eval_cache>(settings.eval_cache_mb);
+
+        //      (0 -  )
+        if (settings.hash_mb)
+            tt = make_shared<Transposition_table>(settings.hash_mb);
+    }
+
+    //  find_best_turns   ,
+    // ,   ,       color   mtx.
+    //    score,      
+    // (-1,   ).
+    vector<move_pos> find_best_turns(const vector<vector<POS_T>>& mtx, const bool color, double* score = nullptr)
+    {
+        TRACE_SPAN("find_best_turns");
+
+        //    
+        next_best_state.clear();
+        next_move.clear();
+        aborted = false;
+
+        //       ,    
+        board_state st(mtx);
+        if (scoring_mode == BotScoringType::Network)
+            st.attach(network.get());
+        if (scoring_mode == BotScoringType::Patterns)
+            st.attach(patterns.get());
+        find_turns(color, st);
+
+        //  -  (-1, -1) ,      ,
+        //  state == 0    .
+        double best_score = search_root(st, color);
+        if (score)
+            *score = best_score;
+
+        //   ,    ( 0)
+        int cur_state = 0;
+        vector<move_pos> result;
+        while (cur_state != -1 && next_move[cur_state].x != -1)
+        {
+            result.push_back(next_move[cur_state]);
+            cur_state = next_best_state[cur_state];
+        }
+        return result;
+    }
+
+    //  principal_variation     mtx:   first  color
+    //     ,      (   Max_depth + 1 ).
+    //        .   
+    // (stop_flag  deadline),  .
+    vector<vector<move_pos>> principal_variation(vector<vector<POS_T>> mtx, bool color, const vector<move_pos>& first)
+    {
+        vector<vector<move_pos>> pv;
+        const int depth = Max_depth;
+        vector<move_pos> turn = first;
+        while (!turn.empty())
+        {
+            pv.push_back(turn);
+            for (const auto& step : turn)
+                mtx = make_turn(mtx, step);
+            color = !color;
+            if (--Max_depth < 0)
+                break;
+            turn = find_best_turns(mtx, color);
+            if (aborted)
+                break;
+        }
+        Max_depth = depth;
+        return pv;
+    }
+
+    //     (    ,
+    //      )
+    BotScoringType get_scoring_mode() const
+    {
+        return scoring_mode;
+    }
+
+    //  find_full_turns      color   mtx.
+    //   -   ,    .
+    vector<vector<move_pos>> find_full_turns(const vector<vector<POS_T>>& mtx, const bool color)
+    {
+        board_state st(mtx);
+        return find_full_turns(st, color);
+    }
+
+    //  find_full_turns      color    st
+    // (    )
+    vector<vector<move_pos>> find_full_turns(board_state& st, const bool color)
+    {
+        vector<vector<move_pos>> result;
+        find_turns(color, st);
+        auto current_turns = turns;
+        bool current_have_beats = have_beats;
+        for (auto turn : current_turns)
+        {
+            vector<move_pos> series{ turn };
+            if (current_have_beats)
+            {
+                undo_info undo;
+                st.make_turn(turn, undo);
+                add_beat_series(st, series, result);
+                st.unmake_turn(turn, undo);
+            }
+            else
+                result.push_back(series);
+        }
+        return result;
+    }
+
+    //  make_turn     (),
+    //     turn    mtx.
+    vector<vector<POS_T>> make_turn(vector<vector<POS_T>> mtx, move_pos turn) const
+    {
+        //     (capturing move),   
+        if (turn.xb != -1)
+            mtx[turn.xb][turn.yb] = 0;
+
+        //          ,
+        //  ,    
+        if ((mtx[turn.x][turn.y] == 1 && turn.x2 == 0) || (mtx[turn.x][turn.y] == 2 && turn.x2 == 7))
+            mtx[turn.x][turn.y] += 2;
+
+        //     
+        mtx[turn.x2][turn.y2] = mtx[turn.x][turn.y];
+
+        //   
+        mtx[turn.x][turn.y] = 0;
+        return mtx;
+    }
+
+private:
+    //  search_root    .     
+    //   ,      .
+    double search_root(board_state& st, const bool color)
+    {
+        switch (scoring_mode)
+        {
+        case BotScoringType::NumberAndPotential:
+            return search_root<BotScoringType::NumberAndPotential>(st, color);
+        case BotScoringType::Network:
+            return search_root<BotScoringType::Network>(st, color);
+        case BotScoringType::Patterns:
+            return search_root<BotScoringType::Patterns>(st, color);
+        default:
+            return search_root<BotScoringType::NumberOnly>(st, color);
+        }
+    }
+
+    template <BotScoringType Scoring>
+    double search_root(board_state& st, const bool color)
+    {
+        // O2      ,  O1
+        if (optimization == Optimization::O0)
+            return search_root<Scoring, Optimization::O0>(st, color);
+        return search_root<Scoring, Optimization::O1>(st, color);
+    }
+
+    template <BotScoringType Scoring, Optimization Opt>
+    double search_root(board_state& st, const bool color)
+    {
+        if (eval_cache)
+            return find_first_best_turn<Scoring, Opt, true>(st, color, -1, -1, 0);
+        return find_first_best_turn<Scoring, Opt, false>(st, color, -1, -1, 0);
+    }
+
+    //  evaluate   .    ,   
+    //     ,      calc_score.
+    template <BotScoringType Scoring, bool Cached>
+    double evaluate(const board_state& st, const bool first_bot_color)
+    {
+        if constexpr (!Cached)
+        {
+            return calc_score<Scoring>(st, first_bot_color);
+        }
+        else
+        {
+            //    ,     ,     
+            const uint64_t key = st.hash ^ Zobrist::side(first_bot_color);
+            double score;
+            ++cache_probes;
+            if (eval_cache->probe(key, score))
+            {
+                ++cache_hits;
+                return score;
+            }
+            score = calc_score<Scoring>(st, first_bot_color);
+            eval_cache->store(key, score);
+            return score;
+        }
+    }
+
+    //  calc_score    .
+    //           ,
+    //       (   "NumberAndPotential").
+    //     board_state   ,     .
+    template <BotScoringType Scoring>
+    double calc_score(const board_state& st, const bool first_bot_color) const
+    {
+        //    :
+        // w  wq     , b  bq     .
+        double w = st.w, wq = st.wq, b = st.b, bq = st.bq;
+
+        //      (    )
+        if constexpr (Scoring == BotScoringType::NumberAndPotential)
+        {
+            w += weights.advance * st.w_adv;
+            b += weights.advance * st.b_adv;
+        }
+
+        //    ()   ,    
+        if (!first_bot_color)
+        {
+            swap(b, w);
+            swap(bq, wq);
+        }
+
+        //      ,    
+        if (w + wq == 0)
+            return INF;
+
+        //      ,   
+        if (b + bq == 0)
+            return 0;
+
+        //         .
+        //      ,     .
+        if constexpr (Scoring == BotScoringType::Network)
+        {
+            const double value = network->evaluate(st.acc);
+            return exp(first_bot_color ? -value : value);
+        }
+
+        // ,   
+        constexpr int q_coef = (Scoring == BotScoringType::NumberOnly ? 4 : 5);
+
+        //  "NumberAndPotential"      
+        if constexpr (Scoring == BotScoringType::NumberAndPotential)
+            return (b + bq * weights.king) / (w + wq * weights.king);
+
+        //         
+        //    ,     
+        if constexpr (Scoring == BotScoringType::Patterns)
+        {
+            const double value = patterns->evaluate(st.pattern_index);
+            return (b + bq * q_coef) / (w + wq * q_coef) * exp(first_bot_color ? -value : value);
+        }
+
+        //      
+        return (b + bq * q_coef) / (w + wq * q_coef);
+    }
+
+    //  calc_scores -   calc_score     :
+    //     batch     batch.scores.
+    //  AVX2   4   ,       .
+    template <BotScoringType Scoring>
+    void calc_scores(eval_batch& batch, const bool first_bot_color) const
+    {
+        static_assert(Scoring == BotScoringType::NumberOnly || Scoring == BotScoringType::NumberAndPotential,
+                      "batched scoring supports only material scoring types");
+        const double adv_coef = (Scoring == BotScoringType::NumberAndPotential ? weights.advance : 0);
+        const double q_coef = (Scoring == BotScoringType::NumberAndPotential ? weights.king : 4);
+
+        //    calc_score,   first_bot_color   
+        const double* den = (first_bot_color ? batch.w : batch.b).data();
+        const double* den_q = (first_bot_color ? batch.wq : batch.bq).data();
+        const double* den_adv = (first_bot_color ? batch.w_adv : batch.b_adv).data();
+        const double* num = (first_bot_color ? batch.b : batch.w).data();
+        const double* num_q = (first_bot_color ? batch.bq : batch.wq).data();
+        const double* num_adv = (first_bot_color ? batch.b_adv : batch.w_adv).data();
+        double* out = batch.scores.data();
+
+        size_t k = 0;
+#ifdef __AVX2__
+        const __m256d adv = _mm256_set1_pd(adv_coef);
+        const __m256d q = _mm256_set1_pd(q_coef);
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d inf = _mm256_set1_pd(INF);
+        for (; k + 4 <= batch.size; k += 4)
+        {
+            __m256d d = _mm256_add_pd(_mm256_loadu_pd(den + k), _mm256_mul_pd(adv, _mm256_loadu_pd(den_adv + k)));
+            __m256d n = _mm256_add_pd(_mm256_loadu_pd(num + k), _mm256_mul_pd(adv, _mm256_loadu_pd(num_adv + k)));
+            __m256d dq = _mm256_loadu_pd(den_q + k);
+            __m256d nq = _mm256_loadu_pd(num_q + k);
+            __m256d res = _mm256_div_pd(_mm256_add_pd(n, _mm256_mul_pd(nq, q)), _mm256_add_pd(d, _mm256_mul_pd(dq, q)));
+
+            //           ,    calc_score
+            res = _mm256_blendv_pd(res, zero, _mm256_cmp_pd(_mm256_add_pd(n, nq), zero, _CMP_EQ_OQ));
+            res = _mm256_blendv_pd(res, inf, _mm256_cmp_pd(_mm256_add_pd(d, dq), zero, _CMP_EQ_OQ));
+            _mm256_storeu_pd(out + k, res);
+        }
+#endif
+        for (; k < batch.size; ++k)
+        {
+            const double d = den[k] + adv_coef * den_adv[k];
+            const double n = num[k] + adv_coef * num_adv[k];
+            if (d + den_q[k] == 0)
+                out[k] = INF;
+            else if (n + num_q[k] == 0)
+                out[k] = 0;
+            else
+                out[k] = (n + num_q[k] * q_coef) / (d + den_q[k] * q_coef);
+        }
+    }
+
+    //  add_beat_series    series   st
+    //    result    
+    void add_beat_series(board_state& st, vector<move_pos>& series, vector<vector<move_pos>>& result)
+    {
+        const move_pos last = series.back();
+        find_turns(last.x2, last.y2, st);
+        if (!have_beats)
+        {
+            result.push_back(series);
+            return;
+        }
+        auto current_turns = turns;
+        for (auto turn : current_turns)
+        {
+            undo_info undo;
+            series.push_back(turn);
+            st.make_turn(turn, undo);
+            add_beat_series(st, series, result);
+            st.unmake_turn(turn, undo);
+            series.pop_back();
+        }
+    }
+
+    //   find_first_best_turn       .
+    // :
+    // - st:    (     );
+    // - color:   ();
+    // - x, y:     ( );
+    // - state:      next_move  next_best_state;
+    // - alpha:    .
+    template <BotScoringType Scoring, Optimization Opt, bool Cached>
+    double find_first_best_turn(board_state& st, const bool color, const POS_T x, const POS_T y, size_t state, double alpha = -1)
+    {
+        ++nodes;
+
+        //   :  ""  
+        next_best_state.push_back(-1);
+        next_move.emplace_back(-1, -1, -1, -1);
+        double best_score = -1;
+
+        //  state   0,           ,
+        //       (x, y)
+        if (state != 0)
+            find_turns(x, y, st);
+
+        //     ,   
+        auto current_turns = turns;
+        bool current_have_beats = have_beats;
+
+        //          ,     
+        if (!current_have_beats && state != 0)
+        {
+            return find_best_turns_rec<Scoring, Opt, Cached>(st, 1 - color, 0, alpha);
+        }
+
+        //       
+        for (auto turn : current_turns)
+        {
+            size_t next_state = next_move.size();
+            double score = 0.0;
+            undo_info undo;
+            st.make_turn(turn, undo);
+            if (current_have_beats)
+            {
+                //    ,       ( )
+                score = find_first_best_turn<Scoring, Opt, Cached>(st, color, turn.x2, turn.y2, next_state, best_score);
+            }
+            else
+            {
+                //        
+                score = find_best_turns_rec<Scoring, Opt, Cached>(st, 1 - color, 0, best_score);
+            }
+            st.unmake_turn(turn, undo);
+
+            //      ,      
+            if (score > best_score)
+            {
+                best_score = score;
+                next_best_state[state] = (current_have_beats ? int(next_state) : -1);
+                next_move[state] = turn;
+            }
+        }
+        return best_score;
+    }
+
+    //   find_best_turns_rec    
+    //    - .
+    // :
+    // - st:   (     );
+    // - color:   ;
+    // - depth:   ;
+    // - alpha, beta:  ;
+    // - x, y:      ( ).
+    template <BotScoringType Scoring, Optimization Opt, bool Cached>
+    double find_best_turns_rec(board_state& st, const bool color, const size_t depth, double alpha = -1, double beta = INF + 1, const POS_T x = -1, const POS_T y = -1)
+    {
+        ++nodes;
+
+        //   1024       .   :
+        // nodes            .
+        //    ,     (. aborted).
+        if ((++poll_counter & 1023) == 0 &&
+            ((stop_flag && stop_flag->load(memory_order_relaxed)) || chrono::steady_clock::now() >= deadline))
+            aborted = true;
+        if (aborted)
+            return 0;
+
+        //     ,   
+        if (depth == Max_depth)
+        {
+            ++leaf_evals;
+            return evaluate<Scoring, Cached>(st, (depth % 2 == color));
+        }
+
+        //   :   ,     ,
+        //    .
+        if (x != -1)
+            find_turns(x, y, st);
+        else
+            find_turns(color, st);
+
+        auto current_turns = turns;
+        bool current_have_beats = have_beats;
+
+        //       (,   ),
+        //     
+        if (!current_have_beats && x != -1)
+        {
+            return find_best_turns_rec<Scoring, Opt, Cached>(st, 1 - color, depth + 1, alpha, beta);
+        }
+
+        //     ,     (   ).
+        //     , ,  ,   
+        // (   )   ,       .
+        uint64_t tt_key = 0;
+        const double alpha_before = alpha, beta_before = beta;
+        const int remaining = Max_depth - int(depth);
+        if (tt && x == -1)
+        {
+            tt_key = st.hash ^ Zobrist::side(color) ^ Zobrist::perspective(depth % 2 == color);
+            int tt_depth;
+            double tt_score;
+            Transposition_table::Bound bound;
+            ++tt_probes;
+            if (tt->probe(tt_key, tt_depth, tt_score, bound) && tt_depth >= remaining)
+            {
+                //    ,     :    
+                //    beta,    -  alpha
+                bool cut = true;
+                double res = tt_score;
+                if (bound == Transposition_table::Bound::Lower)
+                {
+                    cut = tt_score >= beta;
+                    res = (depth % 2 ? tt_score + 1 : tt_score);
+                }
+                else if (bound == Transposition_table::Bound::Upper)
+                {
+                    cut = tt_score <= alpha;
+                    res = (depth % 2 ? tt_score : tt_score - 1);
+                }
+                if (cut)
+                {
+                    ++tt_hits;
+                    return res;
+                }
+            }
+        }
+
+        //     ,   :
+        //     INF,    0.
+        if (current_turns.empty())
+            return (depth % 2 ? 0 : INF);
+
+        double min_score = INF + 1;
+        double max_score = -1;
+
+        //       - .     
+        // ( )          calc_scores.
+        constexpr bool Batched =
+            (Scoring == BotScoringType::NumberOnly || Scoring == BotScoringType::NumberAndPotential) && !Cached;
+        const bool is_batch = Batched && !current_have_beats && x == -1 && int(depth) + 1 == Max_depth;
+        if constexpr (Batched)
+        {
+            if (is_batch)
+            {
+                batch.clear();
+                for (const auto& turn : current_turns)
+                {
+                    undo_info undo;
+                    st.make_turn(turn, undo);
+                    batch.push(st);
+                    st.unmake_turn(turn, undo);
+                }
+                nodes += batch.size;
+                leaf_evals += batch.size;
+                batched_leaves += batch.size;
+                calc_scores<Scoring>(batch, ((depth + 1) % 2 == size_t(1 - color)));
+            }
+        }
+
+        //    
+        for (size_t i = 0; i < current_turns.size(); ++i)
+        {
+            const move_pos& turn = current_turns[i];
+            double score = 0.0;
+            if (is_batch)
+            {
+                //      
+                score = batch.scores[i];
+            }
+            else
+            {
+                undo_info undo;
+                st.make_turn(turn, undo);
+                score = search_child<Scoring, Opt, Cached>(st, turn, color, depth, alpha, beta, current_have_beats, x);
+                st.unmake_turn(turn, undo);
+            }
+            min_score = min(min_score, score);
+            max_score = max(max_score, score);
+
+            //    - :
+            if (depth % 2)
+                alpha = max(alpha, max_score);
+            else
+                beta = min(beta, min_score);
+
+            //       ,  .
+            if (Opt != Optimization::O0 && alpha >= beta)
+            {
+                ++beta_cutoffs;
+                first_move_cutoffs += (i == 0);
+                //    :       beta,
+                //    -   alpha
+                if (tt_key && !aborted)
+                {
+                    if (depth % 2)
+                        tt->store(tt_key, remaining, beta, Transposition_table::Bound::Lower);
+                    else
+                        tt->store(tt_key, remaining, alpha, Transposition_table::Bound::Upper);
+                }
+                return (depth % 2 ? max_score + 1 : min_score - 1);
+            }
+        }
+
+        //     (alpha, beta) -   
+        if (tt_key && !aborted)
+        {
+            if (depth % 2)
+            {
+                if (max_score <= alpha_before)
+                    tt->store(tt_key, remaining, alpha_before, Transposition_table::Bound::Upper);
+                else
+                    tt->store(tt_key, remaining, max_score, Transposition_table::Bound::Exact);
+            }
+            else
+            {
+                if (min_score >= beta_before)
+                    tt->store(tt_key, remaining, beta_before, Transposition_table::Bound::Lower);
+                else
+                    tt->store(tt_key, remaining, min_score, Transposition_table::Bound::Exact);
+            }
+        }
+
+        //          .
+        return (depth % 2 ? max_score : min_score);
+    }
+
+    //  search_child     turn,     st
+    template <BotScoringType Scoring, Optimization Opt, bool Cached>
+    double search_child(board_state& st, const move_pos& turn, const bool color, const size_t depth, const double alpha,
+                        const double beta, const bool current_have_beats, const POS_T x)
+    {
+        if (!current_have_beats && x == -1)
+        {
+            //    ( )      ,
+            //      .
+            return find_best_turns_rec<Scoring, Opt, Cached>(st, 1 - color, depth + 1, alpha, beta);
+        }
+        //    (,  ),     
+        //    .
+        return find_best_turns_rec<Scoring, Opt, Cached>(st, color, depth, alpha, beta, turn.x2, turn.y2);
+    }
+
+public:
+    //       color   mtx (    Board)
+    void find_turns(const vector<vector<POS_T>>& mtx, const bool color)
+    {
+        find_turns(color, board_state(mtx));
+    }
+
+    //       ,    (x, y)
+    void find_turns(const vector<vector<POS_T>>& mtx, const POS_T x, const POS_T y)
+    {
+        find_turns(x, y, board_state(mtx));
+    }
+
+private:
+    //  find_turns         .
+    //    .
+    void find_turns(const bool color, const board_state& st)
+    {
+        const auto& mtx = st.mtx;
+        vector<move_pos> res_turns;
+        bool have_beats_before = false;
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+            {
+                //      (mtx[i][j] != 0     color)
+                if (mtx[i][j] && mtx[i][j] % 2 != color)
+                {
+                    //        (i, j)
+                    find_turns(i, j, st);
+
+                    //         ,   
+                    if (have_beats && !have_beats_before)
+                    {
+                        have_beats_before = true;
+                        res_turns.clear();
+                    }
+
+                    //         ,   
+                    if ((have_beats_before && have_beats) || !have_beats_before)
+                    {
+                        res_turns.insert(res_turns.end(), turns.begin(), turns.end());
+                    }
+                }
+            }
+        }
+
+        //        
+        turns = res_turns;
+
+        //     (    )
+        shuffle(turns.begin(), turns.end(), rand_eng);
+        have_beats = have_beats_before;
+    }
+
+    //  find_turns   ,    (x, y)
+    //    (   )  .
+    void find_turns(const POS_T x, const POS_T y, const board_state& st)
+    {
+        const auto& mtx = st.mtx;
+        turns.clear();
+        have_beats = false;
+        POS_T type = mtx[x][y];
+
+        //   
+        switch (type)
+        {
+        case 1:
+        case 2:
+
+            //      :
+            //     2 
+            for (POS_T i = x - 2; i <= x + 2; i += 4)
+            {
+                for (POS_T j = y - 2; j <= y + 2; j += 4)
+                {
+                    if (i < 0 || i > 7 || j < 0 || j > 7)
+                        continue;
+
+                    //   ,     
+                    POS_T xb = (x + i) / 2, yb = (y + j) / 2;
+
+                    //            ,  
+                    if (mtx[i][j] || !mtx[xb][yb] || mtx[xb][yb] % 2 == type % 2)
+                        continue;
+
+                    //     
+                    turns.emplace_back(x, y, i, j, xb, yb);
+                }
+            }
+            break;
+        default:
+
+            //   (queen)     
+            for (POS_T i = -1; i <= 1; i += 2)
+            {
+                for (POS_T j = -1; j <= 1; j += 2)
+                {
+                    POS_T xb = -1, yb = -1;
+
+                    //           
+                    for (POS_T i2 = x + i, j2 = y + j; i2 != 8 && j2 != 8 && i2 != -1 && j2 != -1; i2 += i, j2 += j)
+                    {
+                        if (mtx[i2][j2])
+                        {
+                            //          ,     
+                            if (mtx[i2][j2] % 2 == type % 2 || (mtx[i2][j2] % 2 != type % 2 && xb != -1))
+                            {
+                                break;
+                            }
+
+                            //      
+                            xb = i2;
+                            yb = j2;
+                        }
+
+                        //   ,    ,    
+                        if (xb != -1 && xb != i2)
+                        {
+                            turns.emplace_back(x, y, i2, j2, xb, yb);
+                        }
+                    }
+                }
+            }
+            break;
+        }
+
+        //     ,   have_beats   
+        if (!turns.empty())
+        {
+            have_beats = true;
+            return;
+        }
+
+        //   ,   
+        switch (type)
+        {
+        case 1:
+        case 2:
+
+            //            
+        {
+            POS_T i = ((type % 2) ? x - 1 : x + 1);
+            for (POS_T j = y - 1; j <= y + 1; j += 2)
+            {
+                if (i < 0 || i > 7 || j < 0 || j > 7 || mtx[i][j])
+                    continue;
+                turns.emplace_back(x, y, i, j);
+            }
+            break;
+        }
+        default:
+
+            //          
+            for (POS_T i = -1; i <= 1; i += 2)
+            {
+                for (POS_T j = -1; j <= 1; j += 2)
+                {
+                    for (POS_T i2 = x + i, j2 = y + j; i2 != 8 && j2 != 8 && i2 != -1 && j2 != -1; i2 += i, j2 += j)
+                    {
+                        if (mtx[i2][j2])
+                            break;
+                        turns.emplace_back(x, y, i2, j2);
+                    }
+                }
+            }
+            break;
+        }
+    }
+
+public:
+    //  :
+    // turns -   ,     .
+    vector<move_pos> turns;
+
+    // have_beats - , ,        .
+    bool have_beats;
+
+    // Max_depth -    ( ).
+    int Max_depth;
+
+    //    (nullptr,  ).   Logic  
+    //      ,      .
+    shared_ptr<Eval_cache> eval_cache;
+
+    //   :    
+    size_t cache_probes = 0;
+    size_t cache_hits = 0;
+
+    //   (nullptr,  ).    ,   
+    //    Logic    .
+    shared_ptr<Transposition_table> tt;
+
+    //   :    ,   
+    size_t tt_probes = 0;
+    size_t tt_hits = 0;
+
+    //  ,   (  ,  )
+    size_t nodes = 0;
+
+    //  ,   nodes,   :   ,
+    //          (   
+    //   ).
+    // ,  ,   nodes  leaf_evals ,  ,  -
+    //    ;   - batched_leaves.    (,   )
+    // nodes  leaf_evals    .
+    size_t leaf_evals = 0;
+    size_t batched_leaves = 0;
+    size_t beta_cutoffs = 0;
+    size_t first_move_cutoffs = 0;
+
+    //  reset_stats      
+    void reset_stats()
+    {
+        nodes = leaf_evals = batched_leaves = beta_cutoffs = first_move_cutoffs = 0;
+        tt_probes = tt_hits = 0;
+    }
+
+    //  :    (    )
+    //   .    , find_best_turns  aborted,
+    //      .
+    const atomic<bool>* stop_flag = nullptr;
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::time_point::max();
+    bool aborted = false;
+
+private:
+    //      
+    default_random_engine rand_eng;
+
+    //   (, NumberAndPotential)
+    BotScoringType scoring_mode;
+
+    //   (, O0, O1)
+    Optimization optimization;
+
+    //      Network
+    shared_ptr<Nnue> network;
+
+    //      Patterns
+    shared_ptr<Patterns> patterns;
+
+    //     NumberAndPotential
+    eval_weights weights;
+
+    //          
+    vector<move_pos> next_move;
+
+    //        
+    vector<int> next_best_state;
+
+    //      (   )
+    eval_batch batch;
+
+    //   find_best_turns_rec -        
+    size_t poll_counter = 0;
+};
\ No newline at end of file
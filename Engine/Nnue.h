@@ -0,0 +1,200 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+#include "../Models/Move.h"
+
+using namespace std;
+
+//    :  (4    32  ),
+//    ()    
+const int Nnue_inputs = 128;
+const int Nnue_l1 = 128;
+const int Nnue_l2 = 32;
+
+//  :     [0, Nnue_activation_max],
+//        Nnue_weight_scale
+const int Nnue_activation_max = 127;
+const int Nnue_weight_scale = 64;
+const double Nnue_output_scale = double(Nnue_activation_max) * Nnue_weight_scale;
+
+//    
+const uint32_t Nnue_version = 1;
+
+//  Nnue -       (  NNUE).
+//    :     
+//     (. board_state),    
+// : int8   uint8 ,   AVX2   .
+//   -       ( ).
+class Nnue
+{
+public:
+    //  load      path.  false,
+    //           .
+    // : "CKNN", ,  ,  b1, w1, b2, w2, b3, w3 (little-endian).
+    bool load(const string& path)
+    {
+        ifstream fin(path, ios_base::binary);
+        if (!fin.is_open())
+            return false;
+        char magic[4];
+        uint32_t header[4];
+        fin.read(magic, sizeof(magic));
+        fin.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!fin || memcmp(magic, "CKNN", 4) != 0 || header[0] != Nnue_version || header[1] != Nnue_inputs ||
+            header[2] != Nnue_l1 || header[3] != Nnue_l2)
+            return false;
+        fin.read(reinterpret_cast<char*>(b1), sizeof(b1));
+        fin.read(reinterpret_cast<char*>(w1), sizeof(w1));
+        fin.read(reinterpret_cast<char*>(b2), sizeof(b2));
+        fin.read(reinterpret_cast<char*>(w2), sizeof(w2));
+        fin.read(reinterpret_cast<char*>(&b3), sizeof(b3));
+        fin.read(reinterpret_cast<char*>(w3), sizeof(w3));
+        return bool(fin);
+    }
+
+    //  save      path   load
+    bool save(const string& path) const
+    {
+        ofstream fout(path, ios_base::binary | ios_base::trunc);
+        if (!fout.is_open())
+            return false;
+        const uint32_t header[4] = { Nnue_version, Nnue_inputs, Nnue_l1, Nnue_l2 };
+        fout.write("CKNN", 4);
+        fout.write(reinterpret_cast<const char*>(header), sizeof(header));
+        fout.write(reinterpret_cast<const char*>(b1), sizeof(b1));
+        fout.write(reinterpret_cast<const char*>(w1), sizeof(w1));
+        fout.write(reinterpret_cast<const char*>(b2), sizeof(b2));
+        fout.write(reinterpret_cast<const char*>(w2), sizeof(w2));
+        fout.write(reinterpret_cast<const char*>(&b3), sizeof(b3));
+        fout.write(reinterpret_cast<const char*>(w3), sizeof(w3));
+        return bool(fout);
+    }
+
+    //      type (1 - 4)    (i, j)
+    static int feature(const POS_T type, const POS_T i, const POS_T j)
+    {
+        return (type - 1) * 32 + i * 4 + j / 2;
+    }
+
+    //  reset    acc    ( )
+    void reset(int16_t* acc) const
+    {
+        memcpy(acc, b1, sizeof(b1));
+    }
+
+    //  add_feature      f (   )
+    void add_feature(int16_t* acc, const int f) const
+    {
+#ifdef __AVX2__
+        for (int j = 0; j < Nnue_l1; j += 16)
+        {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + j));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(w1[f] + j));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(acc + j), _mm256_add_epi16(a, w));
+        }
+#else
+        for (int j = 0; j < Nnue_l1; ++j)
+            acc[j] += w1[f][j];
+#endif
+    }
+
+    //  sub_feature      f (   )
+    void sub_feature(int16_t* acc, const int f) const
+    {
+#ifdef __AVX2__
+        for (int j = 0; j < Nnue_l1; j += 16)
+        {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + j));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(w1[f] + j));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(acc + j), _mm256_sub_epi16(a, w));
+        }
+#else
+        for (int j = 0; j < Nnue_l1; ++j)
+            acc[j] -= w1[f][j];
+#endif
+    }
+
+    //  evaluate      
+    double evaluate(const int16_t* acc) const
+    {
+        alignas(32) uint8_t h1[Nnue_l1];
+        alignas(32) uint8_t h2[Nnue_l2];
+        clip(acc, h1, Nnue_l1);
+
+        //  : h2 = clip((b2 + w2 * h1) / Nnue_weight_scale)
+        for (int k = 0; k < Nnue_l2; ++k)
+        {
+            const int32_t sum = (b2[k] + dot(h1, w2[k], Nnue_l1)) / Nnue_weight_scale;
+            h2[k] = uint8_t(sum < 0 ? 0 : (sum > Nnue_activation_max ? Nnue_activation_max : sum));
+        }
+
+        //  
+        return (b3 + dot(h2, w3, Nnue_l2)) / Nnue_output_scale;
+    }
+
+private:
+    //  clip      [0, Nnue_activation_max]
+    static void clip(const int16_t* acc, uint8_t* out, const int n)
+    {
+#ifdef __AVX2__
+        const __m256i zero = _mm256_setzero_si256();
+        for (int j = 0; j < n; j += 32)
+        {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + j));
+            __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + j + 16));
+
+            // packs   [-128, 127], max     ;
+            // permute      128- 
+            __m256i packed = _mm256_max_epi8(_mm256_packs_epi16(a, b), zero);
+            packed = _mm256_permute4x64_epi64(packed, 0xD8);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out + j), packed);
+        }
+#else
+        for (int j = 0; j < n; ++j)
+            out[j] = uint8_t(acc[j] < 0 ? 0 : (acc[j] > Nnue_activation_max ? Nnue_activation_max : acc[j]));
+#endif
+    }
+
+    //  dot -   n  uint8   int8 (n  32)
+    static int32_t dot(const uint8_t* a, const int8_t* w, const int n)
+    {
+#ifdef __AVX2__
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i sum = _mm256_setzero_si256();
+        for (int j = 0; j < n; j += 32)
+        {
+            __m256i va = _mm256_load_si256(reinterpret_cast<const __m256i*>(a + j));
+            __m256i vw = _mm256_load_si256(reinterpret_cast<const __m256i*>(w + j));
+
+            //    127,    maddubs   int16
+            __m256i prod = _mm256_madd_epi16(_mm256_maddubs_epi16(va, vw), ones);
+            sum = _mm256_add_epi32(sum, prod);
+        }
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+        return _mm_cvtsi128_si32(s);
+#else
+        int32_t sum = 0;
+        for (int j = 0; j < n; ++j)
+            sum += int32_t(a[j]) * w[j];
+        return sum;
+#endif
+    }
+
+public:
+    //     (w2  w3  :    )
+    alignas(32) int16_t b1[Nnue_l1] = {};
+    alignas(32) int16_t w1[Nnue_inputs][Nnue_l1] = {};
+    alignas(32) int32_t b2[Nnue_l2] = {};
+    alignas(32) int8_t w2[Nnue_l2][Nnue_l1] = {};
+    int32_t b3 = 0;
+    alignas(32) int8_t w3[Nnue_l2] = {};
+};
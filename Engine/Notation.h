@@ -0,0 +1,227 @@
+#pragma once
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "State.h"
+
+using namespace std;
+
+//  Notation        ,    :
+//     1  32     (  ),    .
+//      "22-18",    -  "15x22x29" (  ).
+//     FEN  PDN: "W:W21,22,K30:B1-12" -   (W - , B - ),
+//       ,    K, "a-b" -   a  b .
+class Notation
+{
+public:
+    //     FEN
+    static constexpr const char* Start_fen = "W:W21-32:B1-12";
+
+    //    (i, j)
+    static int square(const POS_T i, const POS_T j)
+    {
+        return i * 4 + j / 2 + 1;
+    }
+
+    //  (i, j)    n (1 - 32)
+    static void cell(const int n, POS_T& i, POS_T& j)
+    {
+        i = (n - 1) / 4;
+        j = 2 * ((n - 1) % 4) + 1 - i % 2;
+    }
+
+    //  turn_to_string    turn (   )
+    static string turn_to_string(const vector<move_pos>& turn)
+    {
+        if (turn.empty())
+            return "";
+        const char sep = (turn[0].xb != -1 ? 'x' : '-');
+        string res = to_string(square(turn[0].x, turn[0].y));
+        for (const auto& step : turn)
+            res += sep + to_string(square(step.x2, step.y2));
+        return res;
+    }
+
+    //  parse_squares       text ("22-18", "15x22x29").
+    //   ,   .
+    static vector<int> parse_squares(const string& text)
+    {
+        vector<int> res;
+        int value = 0;
+        bool has_digits = false;
+        for (const char c : text)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                value = value * 10 + (c - '0');
+                has_digits = true;
+            }
+            else if ((c == '-' || c == 'x') && has_digits)
+            {
+                res.push_back(value);
+                value = 0;
+                has_digits = false;
+            }
+            else
+                return {};
+        }
+        if (!has_digits)
+            return {};
+        res.push_back(value);
+        for (int n : res)
+        {
+            if (n < 1 || n > 32)
+                return {};
+        }
+        return res.size() >= 2 ? res : vector<int>{};
+    }
+
+    //  turn_squares      turn (   )
+    static vector<int> turn_squares(const vector<move_pos>& turn)
+    {
+        vector<int> res;
+        if (turn.empty())
+            return res;
+        res.push_back(square(turn[0].x, turn[0].y));
+        for (const auto& step : turn)
+            res.push_back(square(step.x2, step.y2));
+        return res;
+    }
+
+    //  parse_fen     FEN  text:    
+    // (  Training_data)   cells,   -  color.
+    //    ,     .    ,
+    //    .  false,   .
+    static bool parse_fen(const string_view text, array<POS_T, 32>& cells, bool& color)
+    {
+        const char* p = text.data();
+        const char* end = p + text.size();
+        auto skip_spaces = [&]() {
+            while (p != end && (*p == ' ' || *p == '\t' || *p == '"'))
+                ++p;
+        };
+        auto read_number = [&](int& value) {
+            if (p == end || *p < '0' || *p > '9')
+                return false;
+            value = 0;
+            while (p != end && *p >= '0' && *p <= '9')
+                value = value * 10 + (*p++ - '0');
+            return value >= 1 && value <= 32;
+        };
+
+        cells.fill(0);
+        skip_spaces();
+        if (p == end || (*p != 'W' && *p != 'B'))
+            return false;
+        color = (*p++ == 'B');
+
+        //  :    ':'   
+        while (true)
+        {
+            skip_spaces();
+            if (p == end || *p == '.')
+                break;
+            if (*p++ != ':')
+                return false;
+            skip_spaces();
+            if (p == end || (*p != 'W' && *p != 'B'))
+                return false;
+            const POS_T man = (*p++ == 'W') ? 1 : 2;
+            skip_spaces();
+            while (p != end && *p != ':' && *p != '.')
+            {
+                const POS_T type = (*p == 'K') ? man + 2 : man;
+                if (*p == 'K')
+                    ++p;
+                int from, to;
+                if (!read_number(from))
+                    return false;
+                to = from;
+                if (p != end && *p == '-')
+                {
+                    ++p;
+                    if (!read_number(to) || to < from)
+                        return false;
+                }
+                for (int n = from; n <= to; ++n)
+                    cells[n - 1] = type;
+                skip_spaces();
+                if (p != end && *p == ',')
+                {
+                    ++p;
+                    skip_spaces();
+                }
+            }
+        }
+        skip_spaces();
+        if (p != end && *p == '.')
+            ++p;
+        skip_spaces();
+        return p == end;
+    }
+
+    //  parse_fen     FEN    st
+    static bool parse_fen(const string_view text, board_state& st, bool& color)
+    {
+        array<POS_T, 32> cells;
+        if (!parse_fen(text, cells, color))
+            return false;
+        st = board_state(cells);
+        return true;
+    }
+
+    //  parse_fen     FEN    mtx (  Board)
+    static bool parse_fen(const string_view text, vector<vector<POS_T>>& mtx, bool& color)
+    {
+        array<POS_T, 32> cells;
+        if (!parse_fen(text, cells, color))
+            return false;
+        mtx.assign(8, vector<POS_T>(8, 0));
+        for (int n = 1; n <= 32; ++n)
+        {
+            POS_T i, j;
+            cell(n, i, j);
+            mtx[i][j] = cells[n - 1];
+        }
+        return true;
+    }
+
+    //  start_position     ( ,   Board)
+    static vector<vector<POS_T>> start_position()
+    {
+        vector<vector<POS_T>> res;
+        bool color;
+        parse_fen(Start_fen, res, color);
+        return res;
+    }
+
+    //  to_fen  :   mtx (Board  board_state)    color.
+    //      .
+    template <class Matrix> static string to_fen(const Matrix& mtx, const bool color)
+    {
+        string res = color ? "B" : "W";
+        for (const POS_T man : { 1, 2 })
+        {
+            res += man == 1 ? ":W" : ":B";
+            bool first = true;
+            for (int n = 1; n <= 32; ++n)
+            {
+                POS_T i, j;
+                cell(n, i, j);
+                const POS_T type = mtx[i][j];
+                if (type != man && type != man + 2)
+                    continue;
+                if (!first)
+                    res += ',';
+                if (type > 2)
+                    res += 'K';
+                res += to_string(n);
+                first = false;
+            }
+        }
+        return res;
+    }
+};
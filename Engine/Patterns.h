@@ -0,0 +1,208 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../Models/Move.h"
+
+using namespace std;
+
+//    9   4x4 (  2 ),
+//    8  .       :
+//   0 - , 1 -  , 2 -  .
+const int Pattern_regions = 9;
+const int Pattern_squares = 8;
+const int Pattern_size = 6561; // 3 ^ Pattern_squares
+
+//    
+const uint32_t Pattern_version = 1;
+
+//  Patterns -     .
+//           .
+//     board_state   ,    -
+//  Pattern_regions   .      
+//    ,     .
+class Patterns
+{
+public:
+    //      
+    Patterns()
+    {
+        make_default();
+    }
+
+    //  load      path.  false,
+    //        .
+    // : "CKPT", ,  ,  ,   (float).
+    bool load(const string& path)
+    {
+        ifstream fin(path, ios_base::binary);
+        if (!fin.is_open())
+            return false;
+        char magic[4];
+        uint32_t header[3];
+        fin.read(magic, sizeof(magic));
+        fin.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!fin || memcmp(magic, "CKPT", 4) != 0 || header[0] != Pattern_version || header[1] != Pattern_regions ||
+            header[2] != Pattern_size)
+            return false;
+        fin.read(reinterpret_cast<char*>(table), sizeof(table));
+        return bool(fin);
+    }
+
+    //  save      path   load
+    bool save(const string& path) const
+    {
+        ofstream fout(path, ios_base::binary | ios_base::trunc);
+        if (!fout.is_open())
+            return false;
+        const uint32_t header[3] = { Pattern_version, Pattern_regions, Pattern_size };
+        fout.write("CKPT", 4);
+        fout.write(reinterpret_cast<const char*>(header), sizeof(header));
+        fout.write(reinterpret_cast<const char*>(table), sizeof(table));
+        return bool(fout);
+    }
+
+    //  evaluate      
+    double evaluate(const uint16_t* index) const
+    {
+        double res = 0;
+        for (int r = 0; r < Pattern_regions; ++r)
+            res += table[r][index[r]];
+        return res;
+    }
+
+    //  update   ,     (i, j):
+    // digit -   , sign = 1     -1   
+    static void update(uint16_t* index, const POS_T i, const POS_T j, const int digit, const int sign)
+    {
+        for (const auto& m : members.cells[i][j])
+        {
+            if (m.region < 0)
+                break;
+            index[m.region] = uint16_t(index[m.region] + sign * digit * m.weight);
+        }
+    }
+
+    //    type
+    static int digit(const POS_T type)
+    {
+        return type % 2 ? 1 : 2;
+    }
+
+private:
+    //    :     ( )    
+    struct member
+    {
+        int region = -1;
+        int weight = 0;
+    };
+
+    //    -  4 ,    
+    struct member_table
+    {
+        member cells[8][8][4];
+    };
+
+    //     r
+    static int region_row(const int r)
+    {
+        return 2 * (r / 3);
+    }
+    static int region_col(const int r)
+    {
+        return 2 * (r % 3);
+    }
+
+    //  make_members      
+    static member_table make_members()
+    {
+        member_table res;
+        for (int r = 0; r < Pattern_regions; ++r)
+        {
+            int weight = 1;
+            for (int i = region_row(r); i < region_row(r) + 4; ++i)
+            {
+                for (int j = region_col(r); j < region_col(r) + 4; ++j)
+                {
+                    if ((i + j) % 2 == 0)
+                        continue;
+                    int k = 0;
+                    while (res.cells[i][j][k].region != -1)
+                        ++k;
+                    res.cells[i][j][k] = { r, weight };
+                    weight *= 3;
+                }
+            }
+        }
+        return res;
+    }
+
+    //  make_default      :
+    //   ,      ,
+    //      .     
+    // ,    ,     .
+    void make_default()
+    {
+        for (int r = 0; r < Pattern_regions; ++r)
+        {
+            //       
+            vector<pair<int, int>> cells;
+            for (int i = region_row(r); i < region_row(r) + 4; ++i)
+            {
+                for (int j = region_col(r); j < region_col(r) + 4; ++j)
+                {
+                    if ((i + j) % 2 == 1)
+                        cells.emplace_back(i, j);
+                }
+            }
+
+            for (int index = 0; index < Pattern_size; ++index)
+            {
+                int board[8][8] = {};
+                for (int k = 0, rest = index; k < Pattern_squares; ++k, rest /= 3)
+                    board[cells[k].first][cells[k].second] = rest % 3;
+
+                double value = 0;
+                for (const auto& [i, j] : cells)
+                {
+                    if (!board[i][j])
+                        continue;
+                    const int sign = (board[i][j] == 1 ? 1 : -1);
+                    const int advance = (board[i][j] == 1 ? 7 - i : i);
+                    const int back = (board[i][j] == 1 ? 7 : 0);
+                    const int behind = (board[i][j] == 1 ? i + 1 : i - 1);
+                    double cell_value = 0.004 * advance + (i == back ? 0.01 : 0);
+                    for (int dj = -1; dj <= 1; dj += 2)
+                    {
+                        const int j2 = j + dj;
+                        if (behind >= 0 && behind < 8 && j2 >= 0 && j2 < 8 && board[behind][j2] == board[i][j])
+                            cell_value += 0.003;
+                    }
+                    value += sign * cell_value / cover(i, j);
+                }
+                table[r][index] = float(value);
+            }
+        }
+    }
+
+    //  ,     (i, j)
+    static int cover(const int i, const int j)
+    {
+        int res = 0;
+        for (const auto& m : members.cells[i][j])
+            res += (m.region >= 0);
+        return res;
+    }
+
+public:
+    //   
+    float table[Pattern_regions][Pattern_size];
+
+private:
+    //     (   )
+    inline static const member_table members = make_members();
+};
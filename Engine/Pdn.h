@@ -0,0 +1,667 @@
+#pragma once
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "../Models/Move.h"
+#include "Logic.h"
+#include "Notation.h"
+#include "State.h"
+
+using namespace std;
+
+//  Mapped_file       .
+//     data()  ,   .
+class Mapped_file
+{
+public:
+    Mapped_file() = default;
+    Mapped_file(const Mapped_file&) = delete;
+    Mapped_file& operator=(const Mapped_file&) = delete;
+
+    ~Mapped_file()
+    {
+        close();
+    }
+
+    //  open   path  .  false,    .
+    bool open(const string& path)
+    {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            close();
+            return false;
+        }
+        len = size_t(size.QuadPart);
+        if (!len)
+            return true;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+            ptr = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!ptr)
+        {
+            close();
+            return false;
+        }
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        len = size_t(info.st_size);
+        if (len)
+        {
+            void* p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                ::close(fd);
+                len = 0;
+                return false;
+            }
+            //   ,      
+            madvise(p, len, MADV_SEQUENTIAL);
+            ptr = static_cast<const char*>(p);
+        }
+        ::close(fd);
+#endif
+        return true;
+    }
+
+    //  close   
+    void close()
+    {
+#ifdef _WIN32
+        if (ptr)
+            UnmapViewOfFile(ptr);
+        if (mapping)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (ptr)
+            munmap(const_cast<char*>(ptr), len);
+#endif
+        ptr = nullptr;
+        len = 0;
+    }
+
+    //  
+    string_view data() const
+    {
+        return string_view(ptr, len);
+    }
+
+private:
+    const char* ptr = nullptr;
+    size_t len = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+};
+
+//  pdn_game -     PDN:     
+struct pdn_game
+{
+    //   ([ ""] ...)
+    string_view header;
+
+    //    (    ),  
+    string_view moves;
+
+    //      ("1-0", "0-1", "1/2-1/2", "*"  .., ,   )
+    string_view result;
+
+    //  tag    name (,   )
+    string_view tag(const string_view name) const
+    {
+        size_t pos = 0;
+        while ((pos = header.find('[', pos)) != string_view::npos)
+        {
+            ++pos;
+            while (pos < header.size() && header[pos] == ' ')
+                ++pos;
+            const bool match = header.compare(pos, name.size(), name) == 0 && pos + name.size() < header.size() &&
+                               (header[pos + name.size()] == ' ' || header[pos + name.size()] == '"');
+            const size_t begin = header.find('"', pos);
+            const size_t end = begin == string_view::npos ? begin : closing_quote(begin);
+            if (end == string_view::npos)
+                break;
+            if (match)
+                return header.substr(begin + 1, end - begin - 1);
+
+            //    -   
+            pos = end + 1;
+        }
+        return {};
+    }
+
+    //  tags     (  )   
+    vector<pair<string, string>> tags() const
+    {
+        vector<pair<string, string>> res;
+        size_t pos = 0;
+        while ((pos = header.find('[', pos)) != string_view::npos)
+        {
+            const size_t name_begin = header.find_first_not_of(' ', pos + 1);
+            const size_t name_end = header.find_first_of(" \"", name_begin);
+            const size_t begin = name_end == string_view::npos ? name_end : header.find('"', name_end);
+            const size_t end = begin == string_view::npos ? begin : closing_quote(begin);
+            if (end == string_view::npos)
+                break;
+            res.emplace_back(header.substr(name_begin, name_end - name_begin), header.substr(begin + 1, end - begin - 1));
+            pos = end + 1;
+        }
+        return res;
+    }
+
+    //  closing_quote   ,   , 
+    //   begin ( \" ),  npos
+    size_t closing_quote(const size_t begin) const
+    {
+        for (size_t k = begin + 1; k < header.size(); ++k)
+        {
+            if (header[k] == '\\')
+                ++k;
+            else if (header[k] == '"')
+                return k;
+        }
+        return string_view::npos;
+    }
+
+    //  white_score     : 1, 0.5  0 (-1,   )
+    double white_score() const
+    {
+        string_view res = result.empty() ? tag("Result") : result;
+        if (res == "1-0" || res == "2-0")
+            return 1;
+        if (res == "0-1" || res == "0-2")
+            return 0;
+        if (res == "1/2-1/2" || res == "1-1")
+            return 0.5;
+        return -1;
+    }
+};
+
+//  Pdn_reader       PDN (Portable Draughts Notation).
+//    ,   ,    ; 
+//     ,     .
+class Pdn_reader
+{
+public:
+    //  open     path      
+    bool open(const string& path)
+    {
+        text = {};
+        pos = 0;
+        if (!file.open(path))
+            return false;
+        text = file.data();
+        return true;
+    }
+
+    //  attach      data (  ,   )
+    void attach(const string_view data)
+    {
+        file.close();
+        text = data;
+        pos = 0;
+    }
+
+    //  next_game   .  false,    .
+    bool next_game(pdn_game& game)
+    {
+        game = pdn_game();
+        skip_separators();
+        if (pos >= text.size())
+            return false;
+
+        //  -      
+        const size_t header_begin = pos;
+        while (pos < text.size() && text[pos] == '[')
+        {
+            skip_tag();
+            skip_separators();
+        }
+        game.header = text.substr(header_begin, pos - header_begin);
+
+        //     ,        
+        const size_t moves_begin = pos;
+        size_t moves_end = pos;
+        while (pos < text.size())
+        {
+            const char c = text[pos];
+            if (c == '[')
+                break;
+            if (c == '{' || c == '(' || c == ';')
+            {
+                skip_comment();
+                moves_end = pos;
+                continue;
+            }
+            if (is_space(c))
+            {
+                ++pos;
+                continue;
+            }
+            const size_t token_begin = pos;
+            while (pos < text.size() && !is_space(text[pos]) && text[pos] != '{' && text[pos] != '(' && text[pos] != '[')
+                ++pos;
+            const string_view token = text.substr(token_begin, pos - token_begin);
+            if (is_result(token))
+            {
+                game.result = token;
+                break;
+            }
+            moves_end = pos;
+        }
+        game.moves = text.substr(moves_begin, moves_end - moves_begin);
+        return true;
+    }
+
+    //  is_result ,    token  
+    static bool is_result(const string_view token)
+    {
+        return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "2-0" || token == "0-2" ||
+               token == "1-1" || token == "0-0" || token == "*";
+    }
+
+private:
+    static bool is_space(const char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    //  ,   ,   '%',  
+    void skip_separators()
+    {
+        while (pos < text.size())
+        {
+            const char c = text[pos];
+            if (is_space(c))
+                ++pos;
+            else if (c == '{' || c == ';')
+                skip_comment();
+            else if (c == '%' && (pos == 0 || text[pos - 1] == '\n'))
+                skip_comment();
+            else
+                break;
+        }
+    }
+
+    //   [ ""]:      
+    // (   \")   
+    void skip_tag()
+    {
+        bool quoted = false;
+        for (++pos; pos < text.size(); ++pos)
+        {
+            const char c = text[pos];
+            if (quoted && c == '\\')
+                ++pos;
+            else if (c == '"')
+                quoted = !quoted;
+            else if (c == ']' && !quoted)
+            {
+                ++pos;
+                return;
+            }
+        }
+    }
+
+    //   {...},  (...)        
+    void skip_comment()
+    {
+        const char c = text[pos];
+        if (c == ';' || c == '%')
+        {
+            const size_t end = text.find('\n', pos);
+            pos = end == string_view::npos ? text.size() : end + 1;
+            return;
+        }
+        if (c == '{')
+        {
+            const size_t end = text.find('}', pos);
+            pos = end == string_view::npos ? text.size() : end + 1;
+            return;
+        }
+        int depth = 0;
+        while (pos < text.size())
+        {
+            const char d = text[pos++];
+            if (d == '{')
+            {
+                const size_t end = text.find('}', pos);
+                pos = end == string_view::npos ? text.size() : end + 1;
+            }
+            else if (d == '(')
+                ++depth;
+            else if (d == ')' && --depth == 0)
+                break;
+        }
+    }
+
+private:
+    Mapped_file file;
+    string_view text;
+    size_t pos = 0;
+};
+
+//  Pdn_replay           Logic.
+//     next()  st    ,  color - ,
+//   ,  turn -   .   :
+//       next().
+//    (1 - 32,   Notation)  -  ("c3-d4"),
+//  "-", "x"  ":",          .
+class Pdn_replay
+{
+public:
+    //     :  FEN   .
+    // rules - ,      (   ).
+    Pdn_replay(Logic& rules, const pdn_game& game) : rules(rules), moves(game.moves)
+    {
+        const string_view fen = game.tag("FEN");
+        if (!fen.empty())
+        {
+            if (!Notation::parse_fen(fen, st, color))
+                error = "invalid FEN";
+            return;
+        }
+        array<POS_T, 32> cells{};
+        for (int k = 0; k < 12; ++k)
+        {
+            cells[k] = 2;
+            cells[31 - k] = 1;
+        }
+        st = board_state(cells);
+        color = false;
+    }
+
+    //  next    .  false   
+    //    ( error  ).
+    bool next()
+    {
+        if (!error.empty())
+            return false;
+        int squares[Max_squares];
+        int count = 0;
+        string_view token;
+        if (!next_move(token, squares, count))
+            return false;
+
+        //     ,    
+        const auto full_turns = rules.find_full_turns(st, color);
+        const vector<move_pos>* found = nullptr;
+        for (const auto& full_turn : full_turns)
+        {
+            if (!matches(full_turn, squares, count))
+                continue;
+            if (found)
+            {
+                error = "ambiguous move " + string(token) + " at ply " + to_string(ply + 1);
+                return false;
+            }
+            found = &full_turn;
+        }
+        if (!found)
+        {
+            error = "illegal move " + string(token) + " at ply " + to_string(ply + 1);
+            return false;
+        }
+
+        turn = *found;
+        for (const auto& step : turn)
+        {
+            undo_info undo;
+            st.make_turn(step, undo);
+        }
+        color = !color;
+        ++ply;
+        return true;
+    }
+
+public:
+    //  ,  ,       
+    board_state st;
+    bool color = false;
+    vector<move_pos> turn;
+    int ply = 0;
+
+    //   (,   )
+    string error;
+
+private:
+    //       
+    static constexpr int Max_squares = 16;
+
+    //  next_move            .
+    //  , ,    ("!", "?", "$1") .
+    bool next_move(string_view& token, int* squares, int& count)
+    {
+        while (pos < moves.size())
+        {
+            const char c = moves[pos];
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            {
+                ++pos;
+                continue;
+            }
+            if (c == '{')
+            {
+                const size_t end = moves.find('}', pos);
+                pos = end == string_view::npos ? moves.size() : end + 1;
+                continue;
+            }
+            if (c == ';')
+            {
+                const size_t end = moves.find('\n', pos);
+                pos = end == string_view::npos ? moves.size() : end + 1;
+                continue;
+            }
+            if (c == '(')
+            {
+                skip_variation();
+                continue;
+            }
+            const size_t begin = pos;
+            while (pos < moves.size() && !strchr(" \t\n\r{(;", moves[pos]))
+                ++pos;
+            token = moves.substr(begin, pos - begin);
+
+            //   ("12."  "12...")    ("$3") -  
+            if (token.back() == '.' || token[0] == '$')
+                continue;
+            while (!token.empty() && (token.back() == '!' || token.back() == '?'))
+                token.remove_suffix(1);
+            //        : "12.22-18"
+            const size_t dot = token.rfind('.');
+            if (dot != string_view::npos)
+                token.remove_prefix(dot + 1);
+            if (token.empty())
+                continue;
+            if (!parse_move(token, squares, count))
+            {
+                error = "invalid move " + string(token) + " at ply " + to_string(ply + 1);
+                return false;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    //   (...)      
+    void skip_variation()
+    {
+        int depth = 0;
+        while (pos < moves.size())
+        {
+            const char d = moves[pos++];
+            if (d == '{')
+            {
+                const size_t end = moves.find('}', pos);
+                pos = end == string_view::npos ? moves.size() : end + 1;
+            }
+            else if (d == '(')
+                ++depth;
+            else if (d == ')' && --depth == 0)
+                break;
+        }
+    }
+
+    //  parse_move    token    squares (count -  )
+    static bool parse_move(const string_view token, int* squares, int& count)
+    {
+        count = 0;
+        size_t i = 0;
+        while (i < token.size())
+        {
+            if (count == Max_squares)
+                return false;
+            int square = 0;
+            if (token[i] >= '0' && token[i] <= '9')
+            {
+                while (i < token.size() && token[i] >= '0' && token[i] <= '9')
+                    square = square * 10 + (token[i++] - '0');
+                if (square < 1 || square > 32)
+                    return false;
+            }
+            else if (token[i] >= 'a' && token[i] <= 'h' && i + 1 < token.size() && token[i + 1] >= '1' &&
+                     token[i + 1] <= '8')
+            {
+                //  "c3":      ,   
+                const POS_T y = token[i] - 'a', x = 7 - (token[i + 1] - '1');
+                if ((x + y) % 2 == 0)
+                    return false;
+                square = Notation::square(x, y);
+                i += 2;
+            }
+            else
+                return false;
+            squares[count++] = square;
+            if (i == token.size())
+                break;
+            if (token[i] != '-' && token[i] != 'x' && token[i] != ':')
+                return false;
+            ++i;
+        }
+        return count >= 2;
+    }
+
+    //  matches ,     full_turn  :
+    //    ,    ,   
+    static bool matches(const vector<move_pos>& full_turn, const int* squares, const int count)
+    {
+        if (Notation::square(full_turn[0].x, full_turn[0].y) != squares[0] ||
+            Notation::square(full_turn.back().x2, full_turn.back().y2) != squares[count - 1])
+            return false;
+        if (count == 2)
+            return true;
+        if (count != int(full_turn.size()) + 1)
+            return false;
+        for (int k = 1; k < count - 1; ++k)
+        {
+            if (Notation::square(full_turn[k - 1].x2, full_turn[k - 1].y2) != squares[k])
+                return false;
+        }
+        return true;
+    }
+
+private:
+    Logic& rules;
+    string_view moves;
+    size_t pos = 0;
+};
+
+//  Pdn_writer      PDN
+class Pdn_writer
+{
+public:
+    //  result_string    (1, 0.5, 0)   PDN
+    static string result_string(const double white_score)
+    {
+        return white_score == 1 ? "1-0" : (white_score == 0 ? "0-1" : "1/2-1/2");
+    }
+
+    //  today       Date ("2024.05.17")
+    static string today()
+    {
+        const time_t now = time(nullptr);
+        const tm* local = localtime(&now);
+        char buf[16];
+        strftime(buf, sizeof(buf), "%Y.%m.%d", local);
+        return buf;
+    }
+
+    //  append_game    path :  tags (  ),
+    //   turns,     first_color,   result.
+    //   notes, notes[k] (   ,  "? {best 22-18}")
+    //     k.  false,    .
+    static bool append_game(const string& path, const vector<pair<string, string>>& tags,
+                            const vector<vector<move_pos>>& turns, const bool first_color, const string& result,
+                            const vector<string>& notes = {})
+    {
+        ofstream fout(path, ios_base::app);
+        if (!fout.is_open())
+            return false;
+        for (const auto& [name, value] : tags)
+            fout << '[' << name << " \"" << value << "\"]\n";
+        fout << '\n';
+
+        //        80 
+        string line;
+        auto add_word = [&](const string& word) {
+            if (!line.empty() && line.size() + 1 + word.size() > 80)
+            {
+                fout << line << '\n';
+                line.clear();
+            }
+            line += (line.empty() ? "" : " ") + word;
+        };
+        for (size_t k = 0; k < turns.size(); ++k)
+        {
+            const size_t ply = k + first_color;
+            if (ply % 2 == 0)
+                add_word(to_string(ply / 2 + 1) + ".");
+            else if (k == 0)
+                add_word(to_string(ply / 2 + 1) + "...");
+            add_word(Notation::turn_to_string(turns[k]) + (k < notes.size() ? notes[k] : string()));
+        }
+        add_word(result);
+        fout << line << "\n\n";
+        fout.close();
+        return true;
+    }
+};
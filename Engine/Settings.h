@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+#include "../Models/Bot_modes.h"
+
+using namespace std;
+
+//  engine_settings -   ( "Bot"  settings.json).
+//      :    (. Config::bot_settings),
+//          json.
+struct engine_settings
+{
+    //    (   )
+    bool no_random = false;
+
+    //       
+    BotScoringType scoring_type = BotScoringType::NumberAndPotential;
+    Optimization optimization = Optimization::O1;
+
+    //      (0 -  )
+    size_t eval_cache_mb = 0;
+
+    //      (0 -  )
+    size_t hash_mb = 0;
+
+    //   ,      "NumberAndPotential"
+    string network_path = "nnue.bin";
+    string patterns_path = "patterns.bin";
+    string weights_path = "weights.txt";
+};
@@ -0,0 +1,216 @@
+#pragma once
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "Nnue.h"
+#include "Patterns.h"
+#include "Zobrist.h"
+
+using namespace std;
+
+//  undo_info  ,     :
+//         (0,    )
+struct undo_info
+{
+    POS_T moved = 0;
+    POS_T beaten = 0;
+};
+
+//  board_state - ,     .
+//            ,
+//     make_turn / unmake_turn,      .
+//       (  ,  )
+// ,        ,    
+//     .
+struct board_state
+{
+    board_state() = default;
+
+    //       (  Board)   
+    explicit board_state(const vector<vector<POS_T>>& board)
+    {
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+            {
+                mtx[i][j] = 0;
+                if (board[i][j])
+                {
+                    add_piece(board[i][j], i, j);
+                    hash ^= Zobrist::piece(board[i][j], i, j);
+                }
+            }
+        }
+    }
+
+    //         cells (  Training_data),  k -
+    //   k / 4   2 * (k % 4) + 1 -  % 2
+    explicit board_state(const array<POS_T, 32>& cells)
+    {
+        for (int k = 0; k < 32; ++k)
+        {
+            if (!cells[k])
+                continue;
+            const POS_T i = POS_T(k / 4), j = POS_T(2 * (k % 4) + 1 - (k / 4) % 2);
+            add_piece(cells[k], i, j);
+            hash ^= Zobrist::piece(cells[k], i, j);
+        }
+    }
+
+    //  attach     net     
+    void attach(const Nnue* net)
+    {
+        nnue = net;
+        if (!nnue)
+            return;
+        nnue->reset(acc);
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+            {
+                if (mtx[i][j])
+                    nnue->add_feature(acc, Nnue::feature(mtx[i][j], i, j));
+            }
+        }
+    }
+
+    //  attach      pat    
+    void attach(const Patterns* pat)
+    {
+        patterns = pat;
+        if (!patterns)
+            return;
+        memset(pattern_index, 0, sizeof(pattern_index));
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+            {
+                if (mtx[i][j])
+                    Patterns::update(pattern_index, i, j, Patterns::digit(mtx[i][j]), 1);
+            }
+        }
+    }
+
+    //  make_turn   turn     undo   
+    void make_turn(const move_pos& turn, undo_info& undo)
+    {
+        undo.moved = mtx[turn.x][turn.y];
+        undo.beaten = 0;
+
+        //    ,   
+        if (turn.xb != -1)
+        {
+            undo.beaten = mtx[turn.xb][turn.yb];
+            remove_piece(turn.xb, turn.yb);
+        }
+
+        //  ,    ,   
+        POS_T type = undo.moved;
+        if ((type == 1 && turn.x2 == 0) || (type == 2 && turn.x2 == 7))
+            type += 2;
+
+        remove_piece(turn.x, turn.y);
+        add_piece(type, turn.x2, turn.y2);
+        hash ^= Zobrist::turn_delta(turn, undo.moved, undo.beaten);
+    }
+
+    //  unmake_turn   turn,  make_turn   undo
+    void unmake_turn(const move_pos& turn, const undo_info& undo)
+    {
+        remove_piece(turn.x2, turn.y2);
+        add_piece(undo.moved, turn.x, turn.y);
+        if (undo.beaten)
+            add_piece(undo.beaten, turn.xb, turn.yb);
+        hash ^= Zobrist::turn_delta(turn, undo.moved, undo.beaten);
+    }
+
+    //      Board
+    vector<vector<POS_T>> to_matrix() const
+    {
+        vector<vector<POS_T>> res(8, vector<POS_T>(8, 0));
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+                res[i][j] = mtx[i][j];
+        }
+        return res;
+    }
+
+private:
+    //   type   (i, j)    (  )
+    void add_piece(const POS_T type, const POS_T i, const POS_T j)
+    {
+        mtx[i][j] = type;
+        if (nnue)
+            nnue->add_feature(acc, Nnue::feature(type, i, j));
+        if (patterns)
+            Patterns::update(pattern_index, i, j, Patterns::digit(type), 1);
+        switch (type)
+        {
+        case 1:
+            ++w;
+            w_adv += 7 - i;
+            break;
+        case 2:
+            ++b;
+            b_adv += i;
+            break;
+        case 3:
+            ++wq;
+            break;
+        default:
+            ++bq;
+            break;
+        }
+    }
+
+    //     (i, j)    (  )
+    void remove_piece(const POS_T i, const POS_T j)
+    {
+        if (nnue)
+            nnue->sub_feature(acc, Nnue::feature(mtx[i][j], i, j));
+        if (patterns)
+            Patterns::update(pattern_index, i, j, Patterns::digit(mtx[i][j]), -1);
+        switch (mtx[i][j])
+        {
+        case 1:
+            --w;
+            w_adv -= 7 - i;
+            break;
+        case 2:
+            --b;
+            b_adv -= i;
+            break;
+        case 3:
+            --wq;
+            break;
+        default:
+            --bq;
+            break;
+        }
+        mtx[i][j] = 0;
+    }
+
+public:
+    //  : 1 -  , 2 -  , 3 -  , 4 -  
+    array<array<POS_T, 8>, 8> mtx{};
+
+    //        
+    int w = 0, wq = 0, b = 0, bq = 0;
+
+    //    :   -    (7 - i),   - i
+    int w_adv = 0, b_adv = 0;
+
+    //    
+    uint64_t hash = 0;
+
+    //   (nullptr,    )     
+    const Nnue* nnue = nullptr;
+    alignas(32) int16_t acc[Nnue_l1];
+
+    //    (nullptr,   )   
+    const Patterns* patterns = nullptr;
+    uint16_t pattern_index[Pattern_regions];
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+//    (spans)   Chrome trace-event JSON
+// (  chrome://tracing  ui.perfetto.dev).
+//      : TRACE_SPAN  TRACE_DUMP   .
+//   CHECKERS_TRACE ( CMake CHECKERS_TRACE).
+//   TRACE_SPAN("find_best_turns");  //       
+//   TRACE_DUMP(path);               //      path
+#ifdef CHECKERS_TRACE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//  Trace       :     ,
+//      .     
+// .     ,     
+//    .
+class Trace
+{
+public:
+    // :  ( ),  ( steady_clock)    
+    struct span
+    {
+        const char* name;
+        int64_t start_us;
+        int64_t duration_us;
+    };
+
+    //  record    name    
+    static void record(const char* name, const chrono::steady_clock::time_point start,
+                       const chrono::steady_clock::time_point end)
+    {
+        thread_buffer& buffer = local();
+        const uint64_t index = buffer.count.load(memory_order_relaxed);
+        buffer.spans[index % Buffer_size] = { name, micros(start.time_since_epoch()), micros(end - start) };
+        buffer.count.store(index + 1, memory_order_release);
+    }
+
+    //  dump       path.  false,    .
+    static bool dump(const string& path)
+    {
+        ofstream fout(path);
+        if (!fout.is_open())
+            return false;
+        fout << "{\"traceEvents\":[";
+        bool first = true;
+        lock_guard<mutex> lock(registry().guard);
+        for (const auto& buffer : registry().buffers)
+        {
+            const uint64_t count = buffer->count.load(memory_order_acquire);
+            for (uint64_t k = count > Buffer_size ? count - Buffer_size : 0; k < count; ++k)
+            {
+                const span& s = buffer->spans[k % Buffer_size];
+                fout << (first ? "\n" : ",\n") << "{\"name\":\"" << s.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                     << buffer->tid << ",\"ts\":" << s.start_us << ",\"dur\":" << s.duration_us << '}';
+                first = false;
+            }
+        }
+        fout << "\n]}\n";
+        return true;
+    }
+
+private:
+    //     ( )
+    static constexpr uint64_t Buffer_size = 1 << 16;
+
+    //   : ,        
+    struct thread_buffer
+    {
+        unique_ptr<span[]> spans = make_unique<span[]>(Buffer_size);
+        atomic<uint64_t> count{ 0 };
+        int tid = 0;
+    };
+
+    //    
+    struct buffer_registry
+    {
+        mutex guard;
+        vector<shared_ptr<thread_buffer>> buffers;
+    };
+
+    static buffer_registry& registry()
+    {
+        static buffer_registry res;
+        return res;
+    }
+
+    //  local    ,     
+    static thread_buffer& local()
+    {
+        thread_local shared_ptr<thread_buffer> buffer = [] {
+            auto res = make_shared<thread_buffer>();
+            lock_guard<mutex> lock(registry().guard);
+            res->tid = int(registry().buffers.size()) + 1;
+            registry().buffers.push_back(res);
+            return res;
+        }();
+        return *buffer;
+    }
+
+    //    
+    static int64_t micros(const chrono::steady_clock::duration d)
+    {
+        return chrono::duration_cast<chrono::microseconds>(d).count();
+    }
+};
+
+//  Trace_span       
+class Trace_span
+{
+public:
+    explicit Trace_span(const char* name) : name(name), start(chrono::steady_clock::now())
+    {
+    }
+
+    ~Trace_span()
+    {
+        Trace::record(name, start, chrono::steady_clock::now());
+    }
+
+    Trace_span(const Trace_span&) = delete;
+    Trace_span& operator=(const Trace_span&) = delete;
+
+private:
+    const char* name;
+    chrono::steady_clock::time_point start;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SPAN(name) Trace_span TRACE_CONCAT(trace_span_, __LINE__)(name)
+#define TRACE_DUMP(path) Trace::dump(path)
+
+#else
+
+#define TRACE_SPAN(name) ((void)0)
+#define TRACE_DUMP(path) ((void)0)
+
+#endif
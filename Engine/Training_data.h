@@ -0,0 +1,84 @@
+#pragma once
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../Models/Move.h"
+
+using namespace std;
+
+//  labeled_position -         
+struct labeled_position
+{
+    //   32   (   ,    )
+    array<POS_T, 32> cells{};
+
+    //    : 1 - , 0.5 - , 0 - 
+    double result = 0.5;
+};
+
+//  Training_data         .
+//  :     - 32  (    )    .
+class Training_data
+{
+public:
+    //  append_game    path    positions   result
+    static bool append_game(const string& path, const vector<vector<vector<POS_T>>>& positions, const double result)
+    {
+        ofstream fout(path, ios_base::app);
+        if (!fout.is_open())
+            return false;
+        for (const auto& mtx : positions)
+            write_position(fout, mtx, result);
+        fout.close();
+        return true;
+    }
+
+    //  write_position   out  :   mtx (Board  board_state)
+    //   result
+    template <class Matrix> static void write_position(ostream& out, const Matrix& mtx, const double result)
+    {
+        char line[33];
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 1 - i % 2; j < 8; j += 2)
+                line[i * 4 + j / 2] = char('0' + mtx[i][j]);
+        }
+        line[32] = ' ';
+        out.write(line, 33);
+        out << result << '\n';
+    }
+
+    //  load      path ( ,   )
+    static vector<labeled_position> load(const string& path)
+    {
+        vector<labeled_position> res;
+        ifstream fin(path);
+        string line;
+        double result;
+        while (fin >> line >> result)
+        {
+            if (line.size() != 32)
+                continue;
+            labeled_position pos;
+            for (int k = 0; k < 32; ++k)
+                pos.cells[k] = POS_T(line[k] - '0');
+            pos.result = result;
+            res.push_back(pos);
+        }
+        return res;
+    }
+
+    //  to_matrix        Board
+    static vector<vector<POS_T>> to_matrix(const labeled_position& pos)
+    {
+        vector<vector<POS_T>> mtx(8, vector<POS_T>(8, 0));
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 1 - i % 2; j < 8; j += 2)
+                mtx[i][j] = pos.cells[i * 4 + j / 2];
+        }
+        return mtx;
+    }
+};
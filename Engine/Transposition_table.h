@@ -0,0 +1,105 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+using namespace std;
+
+//  Transposition_table -   :      ,
+//    ,     (   ).
+//   Eval_cache,    :     , 
+//  - XOR    ,      
+//   .       Logic .
+class Transposition_table
+{
+public:
+    //  :  ,   (   beta)
+    //    (     alpha)
+    enum class Bound : uint8_t
+    {
+        Exact,
+        Lower,
+        Upper
+    };
+
+    //       size_mb 
+    // (      )
+    explicit Transposition_table(const size_t size_mb)
+    {
+        size_t count = 1;
+        while (count * 2 * sizeof(entry) <= size_mb * 1024 * 1024)
+            count *= 2;
+        table = make_unique<entry[]>(count);
+        mask = count - 1;
+    }
+
+    //  probe     key.     
+    //  depth,  score    bound   true.
+    bool probe(const uint64_t key, int& depth, double& score, Bound& bound) const
+    {
+        const entry& e = table[key & mask];
+        const uint64_t data = e.score.load(memory_order_relaxed);
+        const uint64_t meta = e.meta.load(memory_order_relaxed);
+        if ((e.check.load(memory_order_relaxed) ^ data ^ meta) != key || !(meta & Valid))
+            return false;
+        memcpy(&score, &data, sizeof(score));
+        depth = int(meta & 0xff);
+        bound = Bound((meta >> 8) & 0xff);
+        return true;
+    }
+
+    //  store       key,   
+    void store(const uint64_t key, const int depth, const double score, const Bound bound)
+    {
+        entry& e = table[key & mask];
+        uint64_t data;
+        memcpy(&data, &score, sizeof(data));
+        const uint64_t meta = Valid | (uint64_t(bound) << 8) | uint64_t(depth & 0xff);
+        e.check.store(key ^ data ^ meta, memory_order_relaxed);
+        e.score.store(data, memory_order_relaxed);
+        e.meta.store(meta, memory_order_relaxed);
+    }
+
+    //  clear  
+    void clear()
+    {
+        for (size_t i = 0; i <= mask; ++i)
+        {
+            table[i].check.store(0, memory_order_relaxed);
+            table[i].score.store(0, memory_order_relaxed);
+            table[i].meta.store(0, memory_order_relaxed);
+        }
+    }
+
+    //    
+    size_t size() const
+    {
+        return mask + 1;
+    }
+
+    //  fill     (   )
+    double fill() const
+    {
+        size_t used = 0;
+        for (size_t i = 0; i <= mask; ++i)
+            used += (table[i].meta.load(memory_order_relaxed) & Valid) != 0;
+        return double(used) / size();
+    }
+
+private:
+    //   :        
+    static constexpr uint64_t Valid = uint64_t(1) << 63;
+
+    //  :  ,  ( double)   
+    // ( ,     )
+    struct entry
+    {
+        atomic<uint64_t> check{ 0 };
+        atomic<uint64_t> score{ 0 };
+        atomic<uint64_t> meta{ 0 };
+    };
+
+    unique_ptr<entry[]> table;
+    size_t mask;
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../Models/Move.h"
+
+using namespace std;
+
+//  Zobrist        .
+//   -  XOR         ,  .
+class Zobrist
+{
+public:
+    //   type (1 - 4)   (i, j)
+    static uint64_t piece(const POS_T type, const POS_T i, const POS_T j)
+    {
+        return keys[type][i][j];
+    }
+
+    //  ,   (   )
+    static uint64_t side(const bool color)
+    {
+        return color ? side_key : 0;
+    }
+
+    //  ,        (   ).
+    //  ,      ,  ,    ( ).
+    static uint64_t perspective(const bool color)
+    {
+        return color ? perspective_key : 0;
+    }
+
+    //  turn_delta       turn  moved
+    //    beaten (0 -  ),     .
+    //     XOR.
+    static uint64_t turn_delta(const move_pos& turn, const POS_T moved, const POS_T beaten)
+    {
+        POS_T type = moved;
+        if ((type == 1 && turn.x2 == 0) || (type == 2 && turn.x2 == 7))
+            type += 2;
+        uint64_t res = piece(moved, turn.x, turn.y) ^ piece(type, turn.x2, turn.y2);
+        if (beaten)
+            res ^= piece(beaten, turn.xb, turn.yb);
+        return res;
+    }
+
+    //  hash     mtx    color
+    static uint64_t hash(const vector<vector<POS_T>>& mtx, const bool color)
+    {
+        uint64_t h = side(color);
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+            {
+                if (mtx[i][j])
+                    h ^= piece(mtx[i][j], i, j);
+            }
+        }
+        return h;
+    }
+
+private:
+    //     ,
+    //      (     )
+    static array<array<array<uint64_t, 8>, 8>, 5> make_keys()
+    {
+        mt19937_64 gen(20240501);
+        array<array<array<uint64_t, 8>, 8>, 5> res{};
+        for (POS_T type = 1; type <= 4; ++type)
+        {
+            for (POS_T i = 0; i < 8; ++i)
+            {
+                for (POS_T j = 0; j < 8; ++j)
+                    res[type][i][j] = gen();
+            }
+        }
+        return res;
+    }
+
+    //  : keys[type][i][j]
+    inline static const array<array<array<uint64_t, 8>, 8>, 5> keys = make_keys();
+
+    //   
+    inline static const uint64_t side_key = mt19937_64(19700101)();
+
+    //    
+    inline static const uint64_t perspective_key = mt19937_64(19700102)();
+};
@@ -1,10 +1,14 @@
 #pragma once
+#include <array>
 #include <iostream>
 #include <fstream>
 #include <vector>
 
 #include "../Models/Move.h"
+#include "../Engine/Trace.h"
 #include "../Models/Project_path.h"
+#include "Latency.h"
+#include "Logger.h"
 
 #ifdef __APPLE__
     #include <SDL2/SDL.h>
@@ -22,8 +26,8 @@ public:
     //   
     Board() = default;
 
-    // ,     (  )
-    Board(const unsigned int W, const unsigned int H) : W(W), H(H)
+    // ,     (  )    
+    Board(const unsigned int W, const unsigned int H, Logger* logger = nullptr) : W(W), H(H), logger(logger)
     {
     }
 
@@ -71,13 +75,16 @@ public:
         }
 
         //      
-        board = IMG_LoadTexture(ren, board_path.c_str());
-        w_piece = IMG_LoadTexture(ren, piece_white_path.c_str());
-        b_piece = IMG_LoadTexture(ren, piece_black_path.c_str());
-        w_queen = IMG_LoadTexture(ren, queen_white_path.c_str());
-        b_queen = IMG_LoadTexture(ren, queen_black_path.c_str());
-        back = IMG_LoadTexture(ren, back_path.c_str());
-        replay = IMG_LoadTexture(ren, replay_path.c_str());
+        {
+            TRACE_SPAN("load_textures");
+            board = IMG_LoadTexture(ren, board_path.c_str());
+            w_piece = IMG_LoadTexture(ren, piece_white_path.c_str());
+            b_piece = IMG_LoadTexture(ren, piece_black_path.c_str());
+            w_queen = IMG_LoadTexture(ren, queen_white_path.c_str());
+            b_queen = IMG_LoadTexture(ren, queen_black_path.c_str());
+            back = IMG_LoadTexture(ren, back_path.c_str());
+            replay = IMG_LoadTexture(ren, replay_path.c_str());
+        }
 
         // ,     
         if (!board || !w_piece || !b_piece || !w_queen || !b_queen || !back || !replay)
@@ -101,8 +108,6 @@ public:
     void redraw()
     {
         game_results = -1;
-        history_mtx.clear();
-        history_beat_series.clear();
         make_start_mtx();
         clear_active();
         clear_highlight();
@@ -112,44 +117,25 @@ public:
     //    ,   .
     void move_piece(move_pos turn, const int beat_series = 0)
     {
+        history_record record;
         if (turn.xb != -1)
         {
-            //   ,   
+            //   ,   ,      
+            record.xb = turn.xb;
+            record.yb = turn.yb;
+            record.captured = mtx[turn.xb][turn.yb];
             mtx[turn.xb][turn.yb] = 0;
         }
 
-        //       
-        move_piece(turn.x, turn.y, turn.x2, turn.y2, beat_series);
+        //      
+        make_move(turn.x, turn.y, turn.x2, turn.y2, beat_series, record);
     }
 
     //   move_piece,    (i, j)  (i2, j2)
     // beat_series     
     void move_piece(const POS_T i, const POS_T j, const POS_T i2, const POS_T j2, const int beat_series = 0)
     {
-        //     ,  
-        if (mtx[i2][j2])
-        {
-            throw runtime_error("final position is not empty, can't move");
-        }
-
-        //    ,  
-        if (!mtx[i][j])
-        {
-            throw runtime_error("begin position is empty, can't move");
-        }
-
-        //          ,    (queen)
-        if ((mtx[i][j] == 1 && i2 == 0) || (mtx[i][j] == 2 && i2 == 7))
-            mtx[i][j] += 2;
-
-        //     
-        mtx[i2][j2] = mtx[i][j];
-
-        //   
-        drop_piece(i, j);
-
-        //      
-        add_history(beat_series);
+        make_move(i, j, i2, j2, beat_series, history_record());
     }
 
     //  drop_piece   ( )   
@@ -176,6 +162,13 @@ public:
         return mtx;
     }
 
+    //  set_start   start,     (  ).
+    //     .     start_draw  redraw.
+    void set_start(const vector<vector<POS_T>>& start)
+    {
+        start_mtx = start;
+    }
+
     //  highlight_cells   
     void highlight_cells(vector<pair<POS_T, POS_T>> cells)
     {
@@ -219,25 +212,66 @@ public:
         return is_highlighted_[x][y];
     }
 
-    //  rollback   ,    
+    //  rollback    (   ),   
     void rollback()
     {
-        //   :  1     
-        auto beat_series = max(1, *(history_beat_series.rbegin()));
-
-        //       
-        while (beat_series-- && history_mtx.size() > 1)
+        //   :  1    
+        if (!history.empty())
         {
-            history_mtx.pop_back();
-            history_beat_series.pop_back();
+            auto beat_series = max(1, history.back().beat_series);
+            while (beat_series-- && !history.empty())
+                undo_move();
         }
-
-        //      
-        mtx = *(history_mtx.rbegin());
         clear_highlight();
         clear_active();
     }
 
+    //  history_moves       
+    size_t history_moves() const
+    {
+        return history.size();
+    }
+
+    //  history_position    k  (0 -   )
+    //     
+    vector<vector<POS_T>> history_position(const size_t k) const
+    {
+        const size_t frame = Keyframe_interval ? min(k / Keyframe_interval, keyframes.size() - 1) : 0;
+        vector<vector<POS_T>> res = from_keyframe(keyframes[frame]);
+        for (size_t n = frame * Keyframe_interval; n < k; ++n)
+            apply(res, history[n]);
+        return res;
+    }
+
+    //  history_positions         
+    vector<vector<vector<POS_T>>> history_positions() const
+    {
+        vector<vector<vector<POS_T>>> res = { from_keyframe(keyframes[0]) };
+        for (size_t n = 0; n < history.size(); ++n)
+        {
+            res.push_back(res.back());
+            apply(res.back(), history[n]);
+        }
+        return res;
+    }
+
+    //  history_turns    :   
+    //      
+    vector<vector<move_pos>> history_turns() const
+    {
+        vector<vector<move_pos>> res;
+        for (size_t n = 0; n < history.size(); ++n)
+        {
+            const history_record& record = history[n];
+            const move_pos step(record.x, record.y, record.x2, record.y2, record.xb, record.yb);
+            if (!res.empty() && record.beat_series > 1)
+                res.back().push_back(step);
+            else
+                res.push_back({ step });
+        }
+        return res;
+    }
+
     //  show_final    
     void show_final(const int res)
     {
@@ -275,16 +309,126 @@ public:
     }
 
 private:
-    //  add_history            
-    void add_history(const int beat_series = 0)
+    //  :  ,   ( 0 -  ),   
+    //      .       ,   .
+    struct history_record
+    {
+        POS_T x = -1, y = -1, x2 = -1, y2 = -1;
+        POS_T xb = -1, yb = -1;
+        POS_T captured = 0;
+        bool promoted = false;
+        int beat_series = 0;
+    };
+
+    //   (64   )
+    using keyframe = array<POS_T, 64>;
+
+    //     Keyframe_interval  (0 -    ),
+    //          
+    static constexpr size_t Keyframe_interval = 32;
+
+    //  make_move    (i, j)  (i2, j2)    record  
+    void make_move(const POS_T i, const POS_T j, const POS_T i2, const POS_T j2, const int beat_series,
+                   history_record record)
+    {
+        //     ,  
+        if (mtx[i2][j2])
+        {
+            throw runtime_error("final position is not empty, can't move");
+        }
+
+        //    ,  
+        if (!mtx[i][j])
+        {
+            throw runtime_error("begin position is empty, can't move");
+        }
+
+        //          ,    (queen)
+        record.promoted = (mtx[i][j] == 1 && i2 == 0) || (mtx[i][j] == 2 && i2 == 7);
+        if (record.promoted)
+            mtx[i][j] += 2;
+
+        //     
+        mtx[i2][j2] = mtx[i][j];
+
+        //   
+        drop_piece(i, j);
+
+        //     
+        record.x = i;
+        record.y = j;
+        record.x2 = i2;
+        record.y2 = j2;
+        record.beat_series = beat_series;
+        add_history(record);
+    }
+
+    //  add_history   record     
+    void add_history(const history_record& record)
+    {
+        history.push_back(record);
+        if (Keyframe_interval && history.size() % Keyframe_interval == 0)
+            keyframes.push_back(to_keyframe(mtx));
+    }
+
+    //  start_history        
+    void start_history()
     {
-        history_mtx.push_back(mtx);
-        history_beat_series.push_back(beat_series);
+        history.clear();
+        keyframes.assign(1, to_keyframe(mtx));
+    }
+
+    //  undo_move             
+    void undo_move()
+    {
+        if (Keyframe_interval && history.size() % Keyframe_interval == 0)
+            keyframes.pop_back();
+        const history_record record = history.back();
+        history.pop_back();
+        mtx[record.x][record.y] = mtx[record.x2][record.y2] - (record.promoted ? 2 : 0);
+        mtx[record.x2][record.y2] = 0;
+        if (record.xb != -1)
+            mtx[record.xb][record.yb] = record.captured;
+    }
+
+    //  apply   record   matrix
+    static void apply(vector<vector<POS_T>>& matrix, const history_record& record)
+    {
+        if (record.xb != -1)
+            matrix[record.xb][record.yb] = 0;
+        matrix[record.x2][record.y2] = matrix[record.x][record.y] + (record.promoted ? 2 : 0);
+        matrix[record.x][record.y] = 0;
+    }
+
+    static keyframe to_keyframe(const vector<vector<POS_T>>& matrix)
+    {
+        keyframe res;
+        for (POS_T i = 0; i < 8; ++i)
+            for (POS_T j = 0; j < 8; ++j)
+                res[i * 8 + j] = matrix[i][j];
+        return res;
+    }
+
+    static vector<vector<POS_T>> from_keyframe(const keyframe& frame)
+    {
+        vector<vector<POS_T>> res(8, vector<POS_T>(8));
+        for (POS_T i = 0; i < 8; ++i)
+            for (POS_T j = 0; j < 8; ++j)
+                res[i][j] = frame[i * 8 + j];
+        return res;
     }
 
     //  make_start_mtx      
+    // ( ,  set_start)
     void make_start_mtx()
     {
+        if (!start_mtx.empty())
+        {
+            mtx = start_mtx;
+            start_history();
+            return;
+        }
+
         for (POS_T i = 0; i < 8; ++i)
         {
             for (POS_T j = 0; j < 8; ++j)
@@ -301,13 +445,16 @@ private:
             }
         }
 
-        //      
-        add_history();
+        //      
+        start_history();
     }
 
     //  rerender      : , , ,  ,    
     void rerender()
     {
+        TRACE_SPAN("rerender");
+        const auto frame_start = chrono::steady_clock::now();
+
         //      ()
         SDL_RenderClear(ren);
         SDL_RenderCopy(ren, board, NULL, NULL);
@@ -384,7 +531,11 @@ private:
                 result_path = white_path;
             else if (game_results == 2)
                 result_path = black_path;
-            SDL_Texture* result_texture = IMG_LoadTexture(ren, result_path.c_str());
+            SDL_Texture* result_texture;
+            {
+                TRACE_SPAN("load_result_texture");
+                result_texture = IMG_LoadTexture(ren, result_path.c_str());
+            }
             if (result_texture == nullptr)
             {
                 print_exception("IMG_LoadTexture can't load game result picture from " + result_path);
@@ -399,16 +550,17 @@ private:
         SDL_RenderPresent(ren);
 
         //     
+        TRACE_SPAN("rerender_delay");
         SDL_Delay(10);
         SDL_Event windowEvent;
         SDL_PollEvent(&windowEvent);
+        frame_times.record(chrono::steady_clock::now() - frame_start);
     }
 
-    //  print_exception        SDL  -
+    //  print_exception        SDL  
     void print_exception(const string& text) {
-        ofstream fout(project_path + "log.txt", ios_base::app);
-        fout << "Error: " << text << ". " << SDL_GetError() << endl;
-        fout.close();
+        if (logger)
+            logger->error(text + ". " + SDL_GetError());
     }
 
 public:
@@ -416,8 +568,8 @@ public:
     int W = 0;
     int H = 0;
 
-    //    ( )   
-    vector<vector<vector<POS_T>>> history_mtx;
+    //    (rerender) -    
+    Latency_histogram frame_times;
 
 private:
     // SDL     
@@ -433,6 +585,9 @@ private:
     SDL_Texture* back = nullptr;
     SDL_Texture* replay = nullptr;
 
+    //  (nullptr -   )
+    Logger* logger = nullptr;
+
     //    
     const string textures_path = project_path + "Textures/";
     const string board_path = textures_path + "board.png";
@@ -458,6 +613,11 @@ private:
     //   : 1 -  , 2 -  , 3 -  , 4 -  
     vector<vector<POS_T>> mtx = vector<vector<POS_T>>(8, vector<POS_T>(8, 0));
 
-    //      
-    vector<int> history_beat_series;
+    //  :     :   
+    //     Keyframe_interval 
+    vector<history_record> history;
+    vector<keyframe> keyframes;
+
+    //   ,  set_start ( -  )
+    vector<vector<POS_T>> start_mtx;
 };
\ No newline at end of file
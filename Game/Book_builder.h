@@ -0,0 +1,324 @@
+#pragma once
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_set>
+
+#include "../Engine/Book.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "Config.h"
+
+//  Book_builder     drop-out expansion.
+//      :     , 
+// ,   ,  .      
+// :     ,      
+//     ,   - .    (   
+//     ),      .
+//       ,       .
+class Book_builder
+{
+public:
+    //        "Book" 
+    Book_builder(Config* config) : bot_settings(config->bot_settings())
+    {
+        path = project_path + string((*config)("Book", "Path"));
+        threads_num = (*config)("Book", "Threads");
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        search_level = (*config)("Book", "SearchLevel");
+        expansions = (*config)("Book", "Expansions");
+        dropout_weight = (*config)("Book", "DropoutWeight");
+        save_every = (*config)("Book", "SaveEvery");
+    }
+
+    //  run  ,    
+    //      .  0  .
+    int run()
+    {
+        book.load(path);
+        restore_tree();
+        update_values();
+        batch_size = max(16u, threads_num * 4);
+        cout << "Book: " << book.entries.size() << " positions, " << threads_num << " threads" << endl;
+
+        vector<thread> workers;
+        for (unsigned i = 0; i < threads_num; ++i)
+            workers.emplace_back(&Book_builder::worker, this);
+        for (auto& th : workers)
+            th.join();
+
+        lock_guard<mutex> lock(mtx_guard);
+        if (!book.save(path))
+        {
+            cout << "Can't save book to " << path << endl;
+            return 1;
+        }
+        cout << "Book: " << book.entries.size() << " positions, root value " << book.entries[root].value << endl;
+        return 0;
+    }
+
+private:
+    //  node   ,     
+    struct node
+    {
+        vector<vector<POS_T>> mtx;
+        bool color = 0;
+        vector<uint64_t> children;
+        vector<uint64_t> parents;
+        bool in_work = false;
+    };
+
+    //  worker -   :  ,   ,  
+    void worker()
+    {
+        Logic logic(bot_settings);
+        logic.Max_depth = search_level;
+        while (true)
+        {
+            uint64_t key;
+            vector<vector<POS_T>> mtx;
+            bool color;
+            bool is_selected;
+            {
+                lock_guard<mutex> lock(mtx_guard);
+                if (done + in_work_num >= expansions)
+                    return;
+
+                //    ,   
+                if (selected.empty())
+                    select_leaves();
+                is_selected = !selected.empty();
+
+                //       ,    
+                if (!is_selected && in_work_num == 0)
+                    return;
+                if (is_selected)
+                {
+                    key = selected.front();
+                    selected.pop_front();
+                    node& leaf = nodes[key];
+                    ++in_work_num;
+                    mtx = leaf.mtx;
+                    color = leaf.color;
+                }
+            }
+
+            //          -   
+            if (!is_selected)
+            {
+                this_thread::sleep_for(chrono::milliseconds(10));
+                continue;
+            }
+
+            //       
+            vector<pair<uint64_t, vector<vector<POS_T>>>> children;
+            vector<double> values;
+            for (const auto& turn : logic.find_full_turns(mtx, color))
+            {
+                auto child_mtx = Book::apply(mtx, turn, logic);
+                uint64_t child_key = Zobrist::hash(child_mtx, 1 - color);
+                double score = -1;
+                if (!is_known(child_key))
+                    logic.find_best_turns(child_mtx, 1 - color, &score);
+                children.emplace_back(child_key, child_mtx);
+                values.push_back(Book::to_value(score));
+            }
+
+            lock_guard<mutex> lock(mtx_guard);
+            node& leaf = nodes[key];
+            for (size_t i = 0; i < children.size(); ++i)
+            {
+                const uint64_t child_key = children[i].first;
+                leaf.children.push_back(child_key);
+                if (!nodes.count(child_key))
+                {
+                    nodes[child_key] = node{ children[i].second, bool(1 - color) };
+                    book.entries[child_key] = { values[i], false };
+                }
+                nodes[child_key].parents.push_back(key);
+            }
+            book.entries[key].expanded = true;
+            leaf.in_work = false;
+            --in_work_num;
+            back_up(key);
+            if (++done % save_every == 0)
+            {
+                book.save(path);
+                cout << "Expanded " << done << ", book size " << book.entries.size() << endl;
+            }
+        }
+    }
+
+    // ,      (       )
+    bool is_known(const uint64_t key)
+    {
+        lock_guard<mutex> lock(mtx_guard);
+        return nodes.count(key);
+    }
+
+    //  restore_tree   ,    :
+    //            
+    void restore_tree()
+    {
+        Logic logic(bot_settings);
+        vector<vector<POS_T>> start = Notation::start_position();
+        root = Zobrist::hash(start, 0);
+        if (!book.entries.count(root))
+            book.entries[root] = {};
+        nodes[root] = node{ start, 0 };
+
+        vector<uint64_t> stack{ root };
+        while (!stack.empty())
+        {
+            const uint64_t key = stack.back();
+            stack.pop_back();
+            if (!book.entries[key].expanded)
+                continue;
+            const auto mtx = nodes[key].mtx;
+            const bool color = nodes[key].color;
+            vector<pair<uint64_t, vector<vector<POS_T>>>> children;
+            for (const auto& turn : logic.find_full_turns(mtx, color))
+            {
+                auto child_mtx = Book::apply(mtx, turn, logic);
+                const uint64_t child_key = Zobrist::hash(child_mtx, 1 - color);
+
+                //       ,    
+                if (!book.entries.count(child_key))
+                {
+                    book.entries[key].expanded = false;
+                    children.clear();
+                    break;
+                }
+                children.emplace_back(child_key, move(child_mtx));
+            }
+            for (auto& [child_key, child_mtx] : children)
+            {
+                nodes[key].children.push_back(child_key);
+                if (!nodes.count(child_key))
+                {
+                    nodes[child_key] = node{ move(child_mtx), bool(1 - color) };
+                    stack.push_back(child_key);
+                }
+                nodes[child_key].parents.push_back(key);
+            }
+        }
+    }
+
+    //  update_values       (  )
+    void update_values()
+    {
+        unordered_set<uint64_t> visited;
+        function<double(uint64_t)> minimax = [&](const uint64_t key) -> double
+        {
+            book_entry& entry = book.entries[key];
+            if (!entry.expanded || !visited.insert(key).second)
+                return entry.value;
+            const auto& children = nodes[key].children;
+            if (children.empty())
+                return entry.value = -Book_win;
+            double best = -Book_win;
+            for (auto child : children)
+                best = max(best, -minimax(child));
+            return entry.value = best;
+        };
+        minimax(root);
+    }
+
+    //  back_up       key     
+    //   :  ,     .
+    //        (     ).
+    void back_up(const uint64_t key)
+    {
+        unordered_set<uint64_t> visited;
+        vector<uint64_t> stack{ key };
+        while (!stack.empty())
+        {
+            const uint64_t cur = stack.back();
+            stack.pop_back();
+            book_entry& entry = book.entries[cur];
+            if (!entry.expanded || !visited.insert(cur).second)
+                continue;
+            double best = -Book_win;
+            for (auto child : nodes[cur].children)
+                best = max(best, -book.entries[child].value);
+            if (best == entry.value && cur != key)
+                continue;
+            entry.value = best;
+            const auto& parents = nodes[cur].parents;
+            stack.insert(stack.end(), parents.begin(), parents.end());
+        }
+    }
+
+    //  select_leaves   batch_size     
+    //       .
+    //       :    
+    // 1  dropout_weight,      .
+    void select_leaves()
+    {
+        using item = pair<double, uint64_t>;
+        priority_queue<item, vector<item>, greater<item>> queue;
+        unordered_set<uint64_t> closed;
+        queue.emplace(0, root);
+        while (!queue.empty() && selected.size() < batch_size)
+        {
+            auto [priority, key] = queue.top();
+            queue.pop();
+            if (!closed.insert(key).second)
+                continue;
+            const book_entry& entry = book.entries[key];
+            node& cur = nodes[key];
+            if (!entry.expanded)
+            {
+                //      
+                if (!cur.in_work && abs(entry.value) < Book_win)
+                {
+                    cur.in_work = true;
+                    selected.push_back(key);
+                }
+                continue;
+            }
+            for (auto child : cur.children)
+            {
+                const double loss = entry.value + book.entries[child].value;
+                queue.emplace(priority + 1 + dropout_weight * loss, child);
+            }
+        }
+    }
+
+private:
+    //    
+    engine_settings bot_settings;
+
+    //    
+    Book book;
+    string path;
+
+    //   
+    uint64_t root = 0;
+
+    //  : ,   ,   
+    unordered_map<uint64_t, node> nodes;
+
+    //  
+    unsigned threads_num;
+    int search_level;
+    int expansions;
+    double dropout_weight;
+    int save_every;
+
+    //       
+    int done = 0;
+    int in_work_num = 0;
+
+    // ,          
+    deque<uint64_t> selected;
+    size_t batch_size = 16;
+
+    //  ,   
+    mutex mtx_guard;
+};
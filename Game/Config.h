@@ -3,6 +3,7 @@
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
+#include "../Engine/Settings.h"
 #include "../Models/Project_path.h"
 
 class Config
@@ -28,6 +29,22 @@ public:
         return config[setting_dir][setting_name];
     }
 
+    //      section (  "Bot").
+    //     -  project_path.
+    engine_settings bot_settings(const string& section = "Bot") const
+    {
+        engine_settings res;
+        res.no_random = (*this)(section, "NoRandom");
+        res.scoring_type = parse_scoring_type((*this)(section, "BotScoringType"));
+        res.optimization = parse_optimization((*this)(section, "Optimization"));
+        res.eval_cache_mb = (*this)(section, "EvalCacheSizeMB");
+        res.hash_mb = (*this)(section, "HashSizeMB");
+        res.network_path = project_path + string((*this)(section, "NetworkPath"));
+        res.patterns_path = project_path + string((*this)(section, "PatternsPath"));
+        res.weights_path = project_path + string((*this)(section, "WeightsPath"));
+        return res;
+    }
+
 private:
     json config;
 };
\ No newline at end of file
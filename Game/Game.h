@@ -1,20 +1,48 @@
 #pragma once
 #include <chrono>
+#include <map>
 #include <thread>
 
 #include "../Models/Project_path.h"
+#include "../Engine/Book.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "../Engine/Pdn.h"
+#include "../Engine/Training_data.h"
 #include "Board.h"
 #include "Config.h"
 #include "Hand.h"
-#include "Logic.h"
+#include "Latency.h"
+#include "Logger.h"
 
 class Game
 {
 public:
-    Game() : board(config("WindowSize", "Width"), config("WindowSize", "Hight")), hand(&board), logic(&board, &config)
+    Game()
+        : logger(project_path + string(config("Log", "Path")), Logger::parse_level(config("Log", "Level")),
+                 size_t(config("Log", "MaxSizeKB")) * 1024, config("Log", "MaxFiles")),
+          board(config("WindowSize", "Width"), config("WindowSize", "Hight"), &logger), hand(&board),
+          logic(config.bot_settings())
     {
-        ofstream fout(project_path + "log.txt", ios_base::trunc);
-        fout.close();
+        //        JSON
+        const string stats_path = string(config("Game", "SearchStatsPath"));
+        if (!stats_path.empty())
+            stats_logger = make_unique<Logger>(project_path + stats_path, Logger::Level::Info,
+                                               size_t(config("Log", "MaxSizeKB")) * 1024, config("Log", "MaxFiles"), true);
+
+        // ,    ,     
+        if (config("Bot", "BotScoringType") == "Network" && logic.get_scoring_mode() != BotScoringType::Network)
+            logger.error("can't load network weights from " + string(config("Bot", "NetworkPath")) +
+                         ", using NumberAndPotential scoring");
+
+        //   ,      
+        if (config("Book", "UseInGame"))
+            book.load(project_path + string(config("Book", "Path")));
+
+        load_start_position();
+
+        //  F2         
+        hand.on_report = [this] { report_latency(); };
     }
 
     //  
@@ -26,11 +54,12 @@ public:
         //     (replay)
         if (is_replay)
         {
-            //        
-            logic = Logic(&board, &config);
+            //      
+            logic = Logic(config.bot_settings());
 
             //    
             config.reload();
+            load_start_position();
 
             //  
             board.redraw();
@@ -44,8 +73,9 @@ public:
         //   ,       
         is_replay = false;
 
-        //     (  -1,      0)
-        int turn_num = -1;
+        //     (  -1,      0;
+        //       -  0,     )
+        int turn_num = start_color ? 0 : -1;
 
         // ,      
         bool is_quit = false;
@@ -60,7 +90,7 @@ public:
             beat_series = 0;
 
             //        (turn_num % 2 ,  : 0  1)
-            logic.find_turns(turn_num % 2);
+            logic.find_turns(board.get_board(), turn_num % 2);
 
             //    ,    ( )
             if (logic.turns.empty())
@@ -96,7 +126,7 @@ public:
                     //    ,        ,
                     //     
                     if (config("Bot", string("Is") + string((1 - turn_num % 2) ? "Black" : "White") + string("Bot")) &&
-                        !beat_series && board.history_mtx.size() > 2)
+                        !beat_series && board.history_moves() > 1)
                     {
                         board.rollback();
                         --turn_num;
@@ -117,18 +147,26 @@ public:
 
             //      ,   
             else
-                bot_turn(turn_num % 2);
+                bot_turn(turn_num % 2, turn_num);
         }
 
         //    
         auto end = chrono::steady_clock::now();
 
-        //  -     (  )
-        ofstream fout(project_path + "log.txt", ios_base::app);
-
         //     
-        fout << "Game time: " << (int)chrono::duration<double, milli>(end - start).count() << " millisec\n";
-        fout.close();
+        logger.info("Game time: " + to_string((int)chrono::duration<double, milli>(end - start).count()) + " millisec");
+
+        //    ,        
+        if (logic.eval_cache && logic.cache_probes)
+        {
+            logger.info("Eval cache: " + to_string(logic.cache_hits) + " hits of " + to_string(logic.cache_probes) +
+                        " probes (" + to_string(100 * logic.cache_hits / logic.cache_probes) + "%), " +
+                        to_string(int(100 * logic.eval_cache->fill())) + "% of " + to_string(logic.eval_cache->size()) +
+                        " entries used");
+        }
+
+        //     
+        report_latency();
 
         //       ,   
         if (is_replay)
@@ -151,6 +189,17 @@ public:
             res = 1;
         }
 
+        //         
+        if (config("Tuner", "RecordGames"))
+        {
+            Training_data::append_game(project_path + string(config("Tuner", "DataPath")),
+                                       board.history_positions(), res == 0 ? 0.5 : (res == 1 ? 1 : 0));
+        }
+
+        //     PDN
+        if (config("Game", "RecordPdn"))
+            record_pdn(res == 0 ? 0.5 : (res == 1 ? 1 : 0));
+
         //       
         board.show_final(res);
 
@@ -169,11 +218,56 @@ public:
     }
 
 private:
+    //  load_start_position       Game/StartPosition
+    // ( FEN,   -  )    
+    void load_start_position()
+    {
+        vector<vector<POS_T>> start;
+        start_color = false;
+        const string fen = config("Game", "StartPosition");
+        if (!fen.empty() && !Notation::parse_fen(fen, start, start_color))
+        {
+            logger.error("invalid StartPosition " + fen + ", using the initial position");
+            start.clear();
+            start_color = false;
+        }
+        board.set_start(start);
+    }
+
+    //  record_pdn        white_score   Game/PdnPath
+    void record_pdn(const double white_score)
+    {
+        auto player = [&](const string& color) {
+            if (!config("Bot", "Is" + color + "Bot"))
+                return string("Player");
+            return "Bot level " + to_string(int(config("Bot", color + "BotLevel")));
+        };
+        const string result = Pdn_writer::result_string(white_score);
+        vector<pair<string, string>> tags = { { "Event", "Checkers" }, { "Date", Pdn_writer::today() },
+                                              { "White", player("White") }, { "Black", player("Black") },
+                                              { "Result", result } };
+        if (!string(config("Game", "StartPosition")).empty())
+            tags.emplace_back("FEN", Notation::to_fen(board.history_position(0), start_color));
+        if (!Pdn_writer::append_game(project_path + string(config("Game", "PdnPath")), tags,
+                                     board.history_turns(), start_color, result))
+        {
+            logger.error("can't write the game to " + string(config("Game", "PdnPath")));
+        }
+    }
+
     //  
-    void bot_turn(const bool color)
+    void bot_turn(const bool color, const int turn_num)
     {
         //         
         auto start = chrono::steady_clock::now();
+        logic.reset_stats();
+
+        //        -     
+        int pieces = 0;
+        for (const auto& row : board.get_board())
+            for (const POS_T cell : row)
+                pieces += cell != 0;
+        const char* phase = pieces > 16 ? "opening" : (pieces > 8 ? "middlegame" : "endgame");
 
         //    ( )  
         auto delay_ms = config("Bot", "BotDelayMS");
@@ -182,9 +276,18 @@ private:
         //        .
         thread th(SDL_Delay, delay_ms);
 
-        //         find_best_turns,
+        //      ,      ,
+        //         find_best_turns,
         //      .
-        auto turns = logic.find_best_turns(color);
+        //       Book/MinLevel;     (NoRandom),
+        //       .
+        vector<move_pos> turns;
+        if (logic.Max_depth >= int(config("Book", "MinLevel")))
+            turns = book.probe(board.get_board(), color, logic, config("Bot", "NoRandom") ? nullptr : &book_rand);
+        const bool from_book = !turns.empty();
+        if (!from_book)
+            turns = logic.find_best_turns(board.get_board(), color);
+        const auto search_end = chrono::steady_clock::now();
 
         //    ,    
         th.join();
@@ -210,10 +313,41 @@ private:
         //     
         auto end = chrono::steady_clock::now();
 
-        //       -
-        ofstream fout(project_path + "log.txt", ios_base::app);
-        fout << "Bot turn time: " << (int)chrono::duration<double, milli>(end - start).count() << " millisec\n";
-        fout.close();
+        //       
+        logger.info("Bot turn time: " + to_string((int)chrono::duration<double, milli>(end - start).count()) + " millisec");
+        const string level = "bot move level " + to_string(logic.Max_depth);
+        bot_latency[level].record(end - start);
+        bot_latency[level + " " + phase].record(end - start);
+
+        //    -   Game/SearchStatsPath
+        if (stats_logger)
+            record_search_stats(color, turn_num, from_book, chrono::duration<double, milli>(search_end - start).count());
+    }
+
+    //  record_search_stats      JSON       color:
+    //  , ,     ,  , , ,  
+    // (      -    ,  ),
+    //       ,    
+    //     (     ).
+    void record_search_stats(const bool color, const int turn_num, const bool from_book, const double search_ms)
+    {
+        const int depth = logic.Max_depth + 1;
+        json record;
+        record["turn"] = turn_num + 1;
+        record["color"] = color ? "black" : "white";
+        record["level"] = logic.Max_depth;
+        record["book"] = from_book;
+        record["time_ms"] = search_ms;
+        record["nodes"] = logic.nodes;
+        record["nps"] = search_ms > 0 ? size_t(logic.nodes / search_ms * 1000) : 0;
+        record["leaf_evals"] = logic.leaf_evals;
+        record["batched_leaves"] = logic.batched_leaves;
+        record["beta_cutoffs"] = logic.beta_cutoffs;
+        record["first_move_cutoff_pct"] = logic.beta_cutoffs ? 100.0 * logic.first_move_cutoffs / logic.beta_cutoffs : 0.0;
+        record["tt_probes"] = logic.tt_probes;
+        record["tt_hits"] = logic.tt_hits;
+        record["ebf"] = logic.nodes ? pow(double(logic.nodes), 1.0 / depth) : 0.0;
+        stats_logger->info(record.dump());
     }
 
     //  
@@ -309,8 +443,10 @@ private:
                 }
             }
 
-            //      .
+            //      
+            //       .
             board.highlight_cells(cells2);
+            input_latency.record(chrono::steady_clock::now() - hand.click_time);
         }
 
         //          .
@@ -330,7 +466,7 @@ private:
         while (true)
         {
             //      ,     .
-            logic.find_turns(pos.x2, pos.y2);
+            logic.find_turns(board.get_board(), pos.x2, pos.y2);
 
             //     ,  .
             if (!logic.have_beats)
@@ -395,11 +531,35 @@ private:
         return Response::OK;
     }
 
+    //  report_latency     :  ,    
+    //    (     )
+    void report_latency()
+    {
+        logger.info(board.frame_times.summary("Frame render"));
+        logger.info(input_latency.summary("Click to highlight"));
+        for (const auto& [name, histogram] : bot_latency)
+            logger.info(histogram.summary(name));
+    }
+
 private:
     Config config;
+
+    //   (Log/Path)     (Game/SearchStatsPath, nullptr - ).
+    //    ,         .
+    Logger logger;
+    unique_ptr<Logger> stats_logger;
     Board board;
     Hand hand;
     Logic logic;
+    Book book;
+    default_random_engine book_rand{ unsigned(time(0)) };
     int beat_series;
     bool is_replay = false;
+
+    //  :   ("bot move level N"  "bot move level N <>")     
+    map<string, Latency_histogram> bot_latency;
+    Latency_histogram input_latency;
+
+    //  ,       
+    bool start_color = false;
 };
\ No newline at end of file
@@ -1,4 +1,6 @@
 #pragma once
+#include <chrono>
+#include <functional>
 #include <tuple>
 
 #include "../Models/Move.h"
@@ -17,6 +19,7 @@ public:
     //    (Response)     (xc, yc).
     tuple<Response, POS_T, POS_T> get_cell() const
     {
+        TRACE_SPAN("get_cell");
         SDL_Event windowEvent;         //     SDL.
         Response resp = Response::OK;  //    - OK.
         int x = -1, y = -1;            //       .
@@ -38,6 +41,9 @@ public:
                     //     .
                 case SDL_MOUSEBUTTONDOWN:
 
+                    //        
+                    click_time = chrono::steady_clock::now();
+
                     //     .
                     x = windowEvent.motion.x;
                     y = windowEvent.motion.y;
@@ -48,7 +54,7 @@ public:
 
                     //     (xc == -1  yc == -1)    ,
                     //       (BACK).
-                    if (xc == -1 && yc == -1 && board->history_mtx.size() > 1)
+                    if (xc == -1 && yc == -1 && board->history_moves() > 0)
                     {
                         resp = Response::BACK;
                     }
@@ -75,6 +81,12 @@ public:
                     }
                     break;
 
+                    //  F2    
+                case SDL_KEYDOWN:
+                    if (windowEvent.key.keysym.sym == SDLK_F2 && on_report)
+                        on_report();
+                    break;
+
                     //   ,   .
                 case SDL_WINDOWEVENT:
 
@@ -99,6 +111,7 @@ public:
     //    (Response), ,       .
     Response wait() const
     {
+        TRACE_SPAN("wait");
         SDL_Event windowEvent;         //     SDL.
         Response resp = Response::OK;  //    - OK.
 
@@ -115,6 +128,12 @@ public:
                     resp = Response::QUIT;
                     break;
 
+                    //  F2    
+                case SDL_KEYDOWN:
+                    if (windowEvent.key.keysym.sym == SDLK_F2 && on_report)
+                        on_report();
+                    break;
+
                     //    ,   .
                 case SDL_WINDOWEVENT_SIZE_CHANGED:
                     board->reset_window_size();
@@ -149,6 +168,13 @@ public:
         return resp;
     }
 
+public:
+    //      (      )
+    mutable chrono::steady_clock::time_point click_time;
+
+    //    F2 (  ),    
+    function<void()> on_report;
+
 private:
     //    Board,          .
     Board* board;
@@ -0,0 +1,245 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "../Engine/Eval_cache.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "../Engine/Pdn.h"
+#include "../Engine/Transposition_table.h"
+#include "Config.h"
+
+//  Host             
+// (    ).  -  ,   
+//  -    :  ,      
+//   ,        .
+//        .     :
+// ,  , ,      .
+class Host
+{
+public:
+    //      "Host" 
+    Host(Config* config)
+    {
+        settings = config->bot_settings((*config)("Host", "Engine"));
+        level = (*config)("Host", "Level");
+        games_num = (*config)("Host", "Games");
+        threads_num = (*config)("Host", "Threads");
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        opening_plies = (*config)("Host", "OpeningPlies");
+        seed = (*config)("Host", "Seed");
+        const string pdn = string((*config)("Host", "PdnPath"));
+        if (!pdn.empty())
+            pdn_path = project_path + pdn;
+        max_turns = (*config)("Game", "MaxNumTurns");
+
+        //         
+        if (settings.hash_mb)
+            tt = make_shared<Transposition_table>(settings.hash_mb);
+        if (settings.eval_cache_mb)
+            eval_cache = make_shared<Eval_cache>(settings.eval_cache_mb);
+        settings.hash_mb = 0;
+        settings.eval_cache_mb = 0;
+    }
+
+    //  run      .  0.
+    int run()
+    {
+        cout << "Host: " << games_num << " games, level " << level << ", " << threads_num << " threads" << endl;
+        const auto start = chrono::steady_clock::now();
+
+        //  -     ,    
+        Logic rules(settings);
+        games.resize(games_num);
+        for (int i = 0; i < games_num; ++i)
+        {
+            games[i].id = i + 1;
+            mt19937 gen(seed + i);
+            games[i].mtx = Notation::start_position();
+            for (; games[i].turn_num < opening_plies; ++games[i].turn_num)
+            {
+                auto full_turns = rules.find_full_turns(games[i].mtx, games[i].turn_num % 2);
+                if (full_turns.empty())
+                    break;
+                games[i].turns.push_back(full_turns[gen() % full_turns.size()]);
+                for (const auto& step : games[i].turns.back())
+                    games[i].mtx = rules.make_turn(games[i].mtx, step);
+            }
+            ready.push_back(i);
+        }
+
+        vector<thread> workers;
+        for (unsigned i = 0; i < threads_num; ++i)
+            workers.emplace_back(&Host::worker, this);
+        for (auto& th : workers)
+            th.join();
+        report(chrono::duration<double>(chrono::steady_clock::now() - start).count());
+        return 0;
+    }
+
+private:
+    //     
+    struct game_state
+    {
+        int id = 0;
+        vector<vector<POS_T>> mtx;
+        int turn_num = 0;
+        vector<vector<move_pos>> turns;
+
+        //   : 1, 0.5  0 (-1 -  )
+        double result = -1;
+        uint64_t nodes = 0;
+        double search_ms = 0;
+        double max_move_ms = 0;
+    };
+
+    //  worker -   :    ,     
+    //      ,   ,  
+    void worker()
+    {
+        Logic logic(settings);
+        logic.Max_depth = level;
+        logic.tt = tt;
+        logic.eval_cache = eval_cache;
+        while (true)
+        {
+            int index;
+            {
+                unique_lock<mutex> lock(queue_guard);
+                queue_cv.wait(lock, [&] { return !ready.empty() || done == games_num; });
+                if (ready.empty())
+                    return;
+                index = ready.front();
+                ready.pop_front();
+            }
+
+            game_state& game = games[index];
+            if (play_turn(logic, game))
+            {
+                lock_guard<mutex> lock(queue_guard);
+                ready.push_back(index);
+                queue_cv.notify_one();
+                continue;
+            }
+            finish(game);
+            lock_guard<mutex> lock(queue_guard);
+            if (++done == games_num)
+                queue_cv.notify_all();
+        }
+    }
+
+    //  play_turn    game  .  false,   .
+    bool play_turn(Logic& logic, game_state& game) const
+    {
+        if (game.turn_num >= max_turns)
+        {
+            game.result = 0.5;
+            return false;
+        }
+        const bool color = game.turn_num % 2;
+        logic.nodes = 0;
+        const auto start = chrono::steady_clock::now();
+        auto turn = logic.find_best_turns(game.mtx, color);
+        const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        game.nodes += logic.nodes;
+        game.search_ms += ms;
+        game.max_move_ms = max(game.max_move_ms, ms);
+
+        //    
+        if (turn.empty())
+        {
+            game.result = color ? 1 : 0;
+            return false;
+        }
+        for (const auto& step : turn)
+            game.mtx = logic.make_turn(game.mtx, step);
+        game.turns.push_back(move(turn));
+        ++game.turn_num;
+        return true;
+    }
+
+    //  finish     game     PdnPath
+    void finish(game_state& game)
+    {
+        lock_guard<mutex> lock(stats_guard);
+        const int moves = int(game.turns.size());
+        cout << "Game " << game.id << ": " << Pdn_writer::result_string(game.result) << ", moves " << moves
+             << ", nodes " << game.nodes << ", search ms " << int(game.search_ms) << ", max move ms "
+             << int(game.max_move_ms) << endl;
+        ++wdl[game.result == 1 ? 0 : (game.result == 0.5 ? 1 : 2)];
+        total_moves += moves;
+        total_nodes += game.nodes;
+        total_search_ms += game.search_ms;
+        max_move_ms = max(max_move_ms, game.max_move_ms);
+        if (!pdn_path.empty())
+        {
+            const string result = Pdn_writer::result_string(game.result);
+            const string player = "Bot level " + to_string(level);
+            Pdn_writer::append_game(pdn_path,
+                                    { { "Event", "Host game " + to_string(game.id) },
+                                      { "Date", Pdn_writer::today() },
+                                      { "White", player },
+                                      { "Black", player },
+                                      { "Result", result } },
+                                    game.turns, false, result);
+        }
+
+        //    
+        game.mtx.clear();
+        game.turns.clear();
+        game.turns.shrink_to_fit();
+    }
+
+    //  report       sec 
+    void report(const double sec) const
+    {
+        cout << "Games " << games_num << ": white wins " << wdl[0] << ", draws " << wdl[1] << ", black wins "
+             << wdl[2] << endl;
+        cout << "Moves: " << total_moves << ", nodes: " << total_nodes << ", max move ms: " << int(max_move_ms)
+             << endl;
+        cout << "Time (ms): " << int(sec * 1000) << ", games/minute: " << size_t(games_num / max(sec, 1e-9) * 60)
+             << ", nodes/second: " << size_t(total_nodes / max(sec, 1e-9)) << ", thread load: "
+             << int(100 * total_search_ms / max(1.0, sec * 1000 * threads_num)) << "%" << endl;
+    }
+
+private:
+    //     ( ) 
+    engine_settings settings;
+    int level;
+
+    //  
+    int games_num;
+    unsigned threads_num;
+    int opening_plies;
+    unsigned seed;
+    int max_turns;
+    string pdn_path;
+
+    //      
+    shared_ptr<Transposition_table> tt;
+    shared_ptr<Eval_cache> eval_cache;
+
+    // ,  ,  ,    
+    vector<game_state> games;
+    mutex queue_guard;
+    condition_variable queue_cv;
+    deque<int> ready;
+    int done = 0;
+
+    // :  , ,  , ,    
+    mutex stats_guard;
+    array<int, 3> wdl{};
+    size_t total_moves = 0;
+    uint64_t total_nodes = 0;
+    double total_search_ms = 0;
+    double max_move_ms = 0;
+};
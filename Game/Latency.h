@@ -0,0 +1,101 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+using namespace std;
+
+//  Latency_histogram -     HDR Histogram:   
+//   ,      ,  
+//      1/32 ( 3%)       ,
+//    -      .
+class Latency_histogram
+{
+public:
+    //  record   duration
+    void record(const chrono::steady_clock::duration duration)
+    {
+        const int64_t us = chrono::duration_cast<chrono::microseconds>(duration).count();
+        const uint64_t value = uint64_t(max<int64_t>(us, 0));
+        ++counts[index(value)];
+        ++total;
+        max_value = max(max_value, value);
+    }
+
+    //   
+    uint64_t count() const
+    {
+        return total;
+    }
+
+    //  percentile    ,    p  
+    // (  ;  p = 100 -  )
+    double percentile(const double p) const
+    {
+        if (!total)
+            return 0;
+        if (p >= 100)
+            return max_value / 1000.0;
+        const uint64_t rank = max<uint64_t>(1, uint64_t(p / 100 * total + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < Buckets; ++i)
+        {
+            seen += counts[i];
+            if (seen >= rank)
+                return min(upper(i), max_value) / 1000.0;
+        }
+        return max_value / 1000.0;
+    }
+
+    //  summary   "name: count N, p50 .. ms, p90 .. ms, p99 .. ms, max .. ms"
+    string summary(const string& name) const
+    {
+        char buf[160];
+        snprintf(buf, sizeof(buf), ": count %llu, p50 %.1f ms, p90 %.1f ms, p99 %.1f ms, max %.1f ms",
+                 (unsigned long long)total, percentile(50), percentile(90), percentile(99), percentile(100));
+        return name + buf;
+    }
+
+    //  clear   
+    void clear()
+    {
+        counts.fill(0);
+        total = 0;
+        max_value = 0;
+    }
+
+private:
+    //           (  2^45 )
+    static constexpr uint64_t Sub_buckets = 32;
+    static constexpr size_t Buckets = 2 * Sub_buckets + 40 * Sub_buckets;
+
+    //  index    value:   64  ,
+    //  -    5  
+    static size_t index(const uint64_t value)
+    {
+        if (value < 2 * Sub_buckets)
+            return size_t(value);
+        int shift = 0;
+        while ((value >> shift) >= 2 * Sub_buckets)
+            ++shift;
+        return min(Buckets - 1, size_t(2 * Sub_buckets + (shift - 1) * Sub_buckets + ((value >> shift) - Sub_buckets)));
+    }
+
+    //  upper     i
+    static uint64_t upper(const size_t i)
+    {
+        if (i < 2 * Sub_buckets)
+            return i;
+        const uint64_t shift = (i - 2 * Sub_buckets) / Sub_buckets + 1;
+        const uint64_t sub = (i - 2 * Sub_buckets) % Sub_buckets + Sub_buckets;
+        return ((sub + 1) << shift) - 1;
+    }
+
+private:
+    array<uint64_t, Buckets> counts{};
+    uint64_t total = 0;
+    uint64_t max_value = 0;
+};
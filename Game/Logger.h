@@ -0,0 +1,254 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+//  Logger -  . ,   ,   
+//     ;       .
+//              .
+//   ,   (      ).
+//      .    max_bytes,  
+//  path.1 ( path.1 -  path.2  ..,   max_files  )   .
+class Logger
+{
+public:
+    //   (Off -  )
+    enum class Level : uint8_t
+    {
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Off
+    };
+
+    //  parse_level      ("Debug", "Info", "Warning", "Error", "Off")
+    static Level parse_level(const string& name)
+    {
+        if (name == "Debug")
+            return Level::Debug;
+        if (name == "Warning")
+            return Level::Warning;
+        if (name == "Error")
+            return Level::Error;
+        if (name == "Off")
+            return Level::Off;
+        return Level::Info;
+    }
+
+    //    path      .
+    // raw -    ,     (,  JSON).
+    Logger(const string& path, const Level min_level = Level::Info, const size_t max_bytes = 1 << 20,
+           const int max_files = 3, const bool raw = false)
+        : path(path), min_level(min_level), max_bytes(max_bytes), max_files(max_files), raw(raw),
+          slots(make_unique<slot[]>(Capacity))
+    {
+        for (size_t i = 0; i < Capacity; ++i)
+            slots[i].seq.store(i, memory_order_relaxed);
+        if (min_level == Level::Off)
+            return;
+        fout.open(path, ios_base::app | ios_base::ate);
+        written = size_t(max<streamoff>(0, fout.tellp()));
+        writer = thread(&Logger::run, this);
+    }
+
+    //        
+    ~Logger()
+    {
+        if (!writer.joinable())
+            return;
+        stop = true;
+        wake.notify_one();
+        writer.join();
+    }
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    //  enabled ,     level (    )
+    bool enabled(const Level level) const
+    {
+        return level >= min_level && min_level != Level::Off;
+    }
+
+    //  write   text  level  .       .
+    void write(const Level level, string text)
+    {
+        if (!enabled(level))
+            return;
+        size_t pos = tail.load(memory_order_relaxed);
+        slot* cell;
+        while (true)
+        {
+            cell = &slots[pos & (Capacity - 1)];
+            const size_t seq = cell->seq.load(memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0 && tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;
+            if (diff < 0)
+            {
+                dropped.fetch_add(1, memory_order_relaxed);
+                return;
+            }
+            if (diff > 0)
+                pos = tail.load(memory_order_relaxed);
+        }
+        cell->time = chrono::system_clock::now();
+        cell->level = level;
+        cell->text = move(text);
+        cell->seq.store(pos + 1, memory_order_release);
+        wake.notify_one();
+    }
+
+    void debug(string text)
+    {
+        write(Level::Debug, move(text));
+    }
+
+    void info(string text)
+    {
+        write(Level::Info, move(text));
+    }
+
+    void warning(string text)
+    {
+        write(Level::Warning, move(text));
+    }
+
+    void error(string text)
+    {
+        write(Level::Error, move(text));
+    }
+
+private:
+    //   ( )
+    static constexpr size_t Capacity = 4096;
+
+    //  :   (      ,
+    //   )  
+    struct slot
+    {
+        atomic<size_t> seq{ 0 };
+        chrono::system_clock::time_point time;
+        Level level = Level::Info;
+        string text;
+    };
+
+    //  run -   :        
+    void run()
+    {
+        string batch;
+        while (true)
+        {
+            const bool stopping = stop.load();
+            {
+                unique_lock<mutex> lock(wake_guard);
+                wake.wait_for(lock, chrono::milliseconds(100));
+            }
+            batch.clear();
+            drain(batch);
+            if (const size_t lost = dropped.exchange(0, memory_order_relaxed))
+                format(batch, Level::Warning, chrono::system_clock::now(), to_string(lost) + " log records dropped");
+            if (!batch.empty())
+                flush(batch);
+            if (stopping)
+                return;
+        }
+    }
+
+    //  drain        batch
+    void drain(string& batch)
+    {
+        while (true)
+        {
+            slot& cell = slots[head & (Capacity - 1)];
+            if (cell.seq.load(memory_order_acquire) != head + 1)
+                return;
+            format(batch, cell.level, cell.time, cell.text);
+            cell.text.clear();
+            cell.seq.store(head + Capacity, memory_order_release);
+            ++head;
+        }
+    }
+
+    //  format   batch  : ,    (     raw)
+    void format(string& batch, const Level level, const chrono::system_clock::time_point time, const string& text) const
+    {
+        if (!raw)
+        {
+            static const char* const names[] = { "DEBUG", "INFO", "WARNING", "ERROR" };
+            const time_t t = chrono::system_clock::to_time_t(time);
+            const int ms = int(chrono::duration_cast<chrono::milliseconds>(time.time_since_epoch()).count() % 1000);
+            char buf[32];
+            tm local;
+#ifdef _WIN32
+            localtime_s(&local, &t);
+#else
+            localtime_r(&t, &local);
+#endif
+            strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &local);
+            batch += buf;
+            batch += '.';
+            batch += char('0' + ms / 100);
+            batch += char('0' + ms / 10 % 10);
+            batch += char('0' + ms % 10);
+            batch += ' ';
+            batch += names[int(level)];
+            batch += ' ';
+        }
+        batch += text;
+        if (text.empty() || text.back() != '\n')
+            batch += '\n';
+    }
+
+    //  flush   batch         
+    void flush(const string& batch)
+    {
+        fout.write(batch.data(), streamsize(batch.size()));
+        fout.flush();
+        written += batch.size();
+        if (!max_bytes || written < max_bytes)
+            return;
+        fout.close();
+        if (max_files > 0)
+        {
+            remove((path + "." + to_string(max_files)).c_str());
+            for (int k = max_files - 1; k >= 1; --k)
+                rename((path + "." + to_string(k)).c_str(), (path + "." + to_string(k + 1)).c_str());
+            rename(path.c_str(), (path + ".1").c_str());
+        }
+        fout.open(path, ios_base::trunc);
+        written = 0;
+    }
+
+private:
+    //  
+    string path;
+    Level min_level;
+    size_t max_bytes;
+    int max_files;
+    bool raw;
+
+    //  :    (  )    ( )
+    unique_ptr<slot[]> slots;
+    atomic<size_t> tail{ 0 };
+    size_t head = 0;
+    atomic<size_t> dropped{ 0 };
+
+    //  ,       
+    thread writer;
+    ofstream fout;
+    size_t written = 0;
+    mutex wake_guard;
+    condition_variable wake;
+    atomic<bool> stop{ false };
+};
@@ -0,0 +1,226 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "Config.h"
+
+//  Match        .
+//   :          ,
+//    .     ():
+//     - 0, 0.5, 1, 1.5  2 .      
+//       (SPRT)  Elo0  Elo1,
+//   ,     .
+class Match
+{
+public:
+    //       "Match" 
+    Match(Config* config)
+    {
+        engines[0] = config->bot_settings((*config)("Match", "FirstEngine"));
+        engines[1] = config->bot_settings((*config)("Match", "SecondEngine"));
+        levels[0] = (*config)("Match", "FirstLevel");
+        levels[1] = (*config)("Match", "SecondLevel");
+        pairs_num = int((*config)("Match", "Games")) / 2;
+        threads_num = (*config)("Match", "Threads");
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        opening_plies = (*config)("Match", "OpeningPlies");
+        seed = (*config)("Match", "Seed");
+        elo0 = (*config)("Match", "Elo0");
+        elo1 = (*config)("Match", "Elo1");
+        const double alpha = (*config)("Match", "Alpha");
+        const double beta = (*config)("Match", "Beta");
+        lower_bound = log(beta / (1 - alpha));
+        upper_bound = log((1 - beta) / alpha);
+        report_every = (*config)("Match", "ReportEvery");
+        max_turns = (*config)("Game", "MaxNumTurns");
+    }
+
+    //  run     .  0.
+    int run()
+    {
+        cout << "Match: " << 2 * pairs_num << " games, " << threads_num << " threads, SPRT elo0 " << elo0
+             << " elo1 " << elo1 << endl;
+        vector<thread> workers;
+        for (unsigned i = 0; i < threads_num; ++i)
+            workers.emplace_back(&Match::worker, this);
+        for (auto& th : workers)
+            th.join();
+
+        //  ,       
+        lock_guard<mutex> lock(stats_guard);
+        if (!report_every || (2 * pairs_done) % report_every != 0)
+            report();
+        const double llr = sprt_llr();
+        if (llr >= upper_bound)
+            cout << "SPRT: H1 accepted (elo >= " << elo1 << ")" << endl;
+        else if (llr <= lower_bound)
+            cout << "SPRT: H0 accepted (elo <= " << elo0 << ")" << endl;
+        else
+            cout << "SPRT: inconclusive" << endl;
+        return 0;
+    }
+
+private:
+    //  worker -   :   ,     
+    void worker()
+    {
+        Logic first(engines[0]), second(engines[1]);
+        first.Max_depth = levels[0];
+        second.Max_depth = levels[1];
+        int pair;
+        while (!stop && (pair = next_pair++) < pairs_num)
+        {
+            //   -      
+            mt19937 gen(seed + pair);
+            int plies = 0;
+            const auto start = make_opening(first, gen, plies);
+
+            //       ,   - 
+            const double score1 = play_game(start, plies, first, second);
+            const double score2 = 1 - play_game(start, plies, second, first);
+
+            lock_guard<mutex> lock(stats_guard);
+            for (double score : { score1, score2 })
+                ++wdl[score == 1 ? 0 : (score == 0.5 ? 1 : 2)];
+            ++pentanomial[int(2 * (score1 + score2))];
+            ++pairs_done;
+            if (report_every && (2 * pairs_done) % report_every == 0)
+                report();
+
+            //  ,  SPRT    
+            const double llr = sprt_llr();
+            if (llr >= upper_bound || llr <= lower_bound)
+                stop = true;
+        }
+    }
+
+    //  make_opening      opening_plies   .
+    //  plies    .
+    vector<vector<POS_T>> make_opening(Logic& logic, mt19937& gen, int& plies) const
+    {
+        auto mtx = Notation::start_position();
+        for (plies = 0; plies < opening_plies; ++plies)
+        {
+            auto full_turns = logic.find_full_turns(mtx, plies % 2);
+            if (full_turns.empty())
+                break;
+            for (const auto& step : full_turns[gen() % full_turns.size()])
+                mtx = logic.make_turn(mtx, step);
+        }
+        return mtx;
+    }
+
+    //  play_game     mtx  plies 
+    //     : 1 - , 0.5 - , 0 - 
+    double play_game(vector<vector<POS_T>> mtx, const int plies, Logic& white, Logic& black) const
+    {
+        for (int turn_num = plies; turn_num < max_turns; ++turn_num)
+        {
+            const bool color = turn_num % 2;
+            Logic& logic = color ? black : white;
+            auto turn = logic.find_best_turns(mtx, color);
+
+            //    
+            if (turn.empty())
+                return color ? 1 : 0;
+            for (const auto& step : turn)
+                mtx = logic.make_turn(mtx, step);
+        }
+        return 0.5;
+    }
+
+    //  pair_stats     ( 0  1)   
+    //   .  false,    .
+    bool pair_stats(double& mean, double& var) const
+    {
+        if (!pairs_done)
+            return false;
+        mean = 0;
+        for (int k = 0; k < 5; ++k)
+            mean += pentanomial[k] * (k / 4.0);
+        mean /= pairs_done;
+        var = 0;
+        for (int k = 0; k < 5; ++k)
+            var += pentanomial[k] * (k / 4.0 - mean) * (k / 4.0 - mean);
+        var /= pairs_done;
+        return true;
+    }
+
+    //  expected_score       
+    static double expected_score(const double elo)
+    {
+        return 1 / (1 + pow(10, -elo / 400));
+    }
+
+    //  elo      
+    static double elo(const double score)
+    {
+        const double s = clamp(score, 1e-6, 1 - 1e-6);
+        return -400 * log10(1 / s - 1);
+    }
+
+    //      SPRT:       , 
+    //   ,    LLR     
+    static constexpr double Min_pair_variance = 1e-3;
+
+    //  sprt_llr -     elo1  elo0
+    //       ( SPRT)
+    double sprt_llr() const
+    {
+        double mean, var;
+        if (!pair_stats(mean, var))
+            return 0;
+        var = max(var, Min_pair_variance);
+        const double s0 = expected_score(elo0), s1 = expected_score(elo1);
+        return pairs_done * (s1 - s0) * (2 * mean - s0 - s1) / (2 * var);
+    }
+
+    //  report    ,     95%   LLR
+    void report() const
+    {
+        double mean, var;
+        if (!pair_stats(mean, var))
+            return;
+        const double margin = 1.96 * sqrt(var / pairs_done);
+        cout << "Games " << 2 * pairs_done << ": W " << wdl[0] << " D " << wdl[1] << " L " << wdl[2] << ", pairs";
+        for (int k = 0; k < 5; ++k)
+            cout << ' ' << pentanomial[k];
+        cout << ", elo " << elo(mean) << " [" << elo(mean - margin) << ", " << elo(mean + margin) << "]"
+             << ", LLR " << sprt_llr() << " [" << lower_bound << ", " << upper_bound << "]" << endl;
+    }
+
+private:
+    //    ( )  
+    engine_settings engines[2];
+    int levels[2];
+
+    //  
+    int pairs_num;
+    unsigned threads_num;
+    int opening_plies;
+    unsigned seed;
+    int max_turns;
+    int report_every;
+
+    //  SPRT   LLR
+    double elo0, elo1;
+    double lower_bound, upper_bound;
+
+    //       
+    atomic<int> next_pair{ 0 };
+    atomic<bool> stop{ false };
+
+    //   : , ,      (0 - 2    0.5)
+    mutex stats_guard;
+    array<int, 3> wdl{};
+    array<int, 5> pentanomial{};
+    int pairs_done = 0;
+};
@@ -0,0 +1,428 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+using namespace std;
+
+#include "../Engine/Nnue.h"
+#include "Config.h"
+
+//  Nnue_trainer    (. Nnue)  .
+//     ( Training_data)    ,
+//      :      ,
+//    .    float  Adam  ,
+//     (  -   ),
+//      AVX2.     
+//      ,        .
+class Nnue_trainer
+{
+public:
+    //       "Trainer" 
+    Nnue_trainer(Config* config)
+    {
+        data_path = project_path + string((*config)("Trainer", "DataPath"));
+        network_path = project_path + string((*config)("Bot", "NetworkPath"));
+        threads_num = (*config)("Trainer", "Threads");
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        epochs = (*config)("Trainer", "Epochs");
+        batch_size = (*config)("Trainer", "BatchSize");
+        chunk_size = (*config)("Trainer", "ChunkPositions");
+        learning_rate = (*config)("Trainer", "LearningRate");
+        validation_every = (*config)("Trainer", "ValidationEvery");
+        max_validation = (*config)("Trainer", "MaxValidation");
+        seed = (*config)("Trainer", "Seed");
+    }
+
+    //  run     .  0  .
+    int run()
+    {
+        init_params();
+        grads.assign(threads_num, vector<float>(Params_size));
+        adam_m.assign(Params_size, 0);
+        adam_v.assign(Params_size, 0);
+        mt19937 gen(seed);
+
+        for (int epoch = 1; epoch <= epochs; ++epoch)
+        {
+            ifstream fin(data_path);
+            if (!fin.is_open())
+            {
+                cout << "Can't open " << data_path << endl;
+                return 1;
+            }
+            record_index = 0;
+            double loss_sum = 0;
+            size_t trained = 0;
+
+            //     ,    
+            auto next = async(launch::async, &Nnue_trainer::read_chunk, this, ref(fin), epoch == 1);
+            while (true)
+            {
+                vector<record> chunk = next.get();
+                if (chunk.empty())
+                    break;
+                next = async(launch::async, &Nnue_trainer::read_chunk, this, ref(fin), epoch == 1);
+                shuffle(chunk.begin(), chunk.end(), gen);
+                for (size_t from = 0; from < chunk.size(); from += batch_size)
+                {
+                    const size_t to = min(chunk.size(), from + batch_size);
+                    loss_sum += train_batch(chunk, from, to);
+                    trained += to - from;
+                }
+            }
+            if (!trained)
+            {
+                cout << "No positions in " << data_path << endl;
+                return 1;
+            }
+
+            cout << "Epoch " << epoch << ": " << trained << " positions, train loss " << loss_sum / trained;
+            if (!validation.empty())
+                cout << ", validation loss " << validation_loss();
+            cout << endl;
+
+            if (!export_network()->save(network_path))
+            {
+                cout << "Can't save network to " << network_path << endl;
+                return 1;
+            }
+        }
+        cout << "Network saved to " << network_path << endl;
+        return 0;
+    }
+
+private:
+    //  record -   :        
+    struct record
+    {
+        array<uint8_t, 32> features;
+        uint8_t features_num = 0;
+        float result = 0.5;
+    };
+
+    //       (  8  AVX2)
+    static const int W1 = 0;
+    static const int B1 = W1 + Nnue_inputs * Nnue_l1;
+    static const int W2 = B1 + Nnue_l1;
+    static const int B2 = W2 + Nnue_l2 * Nnue_l1;
+    static const int W3 = B2 + Nnue_l2;
+    static const int B3 = W3 + Nnue_l2;
+    static const int Params_size = B3 + 8;
+
+    //      ,    int8  
+    static constexpr float Max_weight = float(Nnue_activation_max) / Nnue_weight_scale;
+
+    //  read_chunk   fin  chunk_size .
+    //  validation_every-     :
+    //         (  max_validation ).
+    vector<record> read_chunk(ifstream& fin, const bool collect_validation)
+    {
+        vector<record> chunk;
+        chunk.reserve(chunk_size);
+        string line;
+        double result;
+        while (chunk.size() < chunk_size && fin >> line >> result)
+        {
+            if (line.size() != 32)
+                continue;
+            record rec;
+            for (int k = 0; k < 32; ++k)
+            {
+                if (line[k] != '0')
+                    rec.features[rec.features_num++] = uint8_t((line[k] - '1') * 32 + k);
+            }
+            rec.result = float(result);
+            if (validation_every && record_index++ % validation_every == 0)
+            {
+                if (collect_validation && validation.size() < max_validation)
+                    validation.push_back(rec);
+                continue;
+            }
+            chunk.push_back(rec);
+        }
+        return chunk;
+    }
+
+    //  init_params    
+    void init_params()
+    {
+        params.assign(Params_size, 0);
+        mt19937 gen(seed);
+        normal_distribution<float> w1_dist(0, 0.1f), w2_dist(0, 1 / sqrt(float(Nnue_l1))),
+            w3_dist(0, 1 / sqrt(float(Nnue_l2)));
+        for (int k = 0; k < Nnue_inputs * Nnue_l1; ++k)
+            params[W1 + k] = w1_dist(gen);
+        for (int k = 0; k < Nnue_l1; ++k)
+            params[B1 + k] = 0.5f;
+        for (int k = 0; k < Nnue_l2 * Nnue_l1; ++k)
+            params[W2 + k] = w2_dist(gen);
+        for (int k = 0; k < Nnue_l2; ++k)
+            params[W3 + k] = w3_dist(gen);
+    }
+
+    //  train_batch     chunk[from, to)    Adam.
+    //     .
+    double train_batch(const vector<record>& chunk, const size_t from, const size_t to)
+    {
+        vector<double> losses(threads_num, 0);
+        auto worker = [&](const unsigned t) {
+            vector<float>& g = grads[t];
+            fill(g.begin(), g.end(), 0.0f);
+            const size_t begin = from + (to - from) * t / threads_num;
+            const size_t end = from + (to - from) * (t + 1) / threads_num;
+            for (size_t i = begin; i < end; ++i)
+                losses[t] += backward(chunk[i], g.data());
+        };
+        vector<thread> workers;
+        for (unsigned t = 0; t < threads_num; ++t)
+            workers.emplace_back(worker, t);
+        for (auto& th : workers)
+            th.join();
+
+        //      
+        for (unsigned t = 1; t < threads_num; ++t)
+            add(grads[0].data(), grads[t].data(), Params_size);
+
+        //  Adam    
+        ++step;
+        const float beta1 = 0.9f, beta2 = 0.999f, eps = 1e-8f;
+        const float scale = 1.0f / float(to - from);
+        const float lr = learning_rate * sqrt(1 - pow(beta2, step)) / (1 - pow(beta1, step));
+        const float* g = grads[0].data();
+        for (int k = 0; k < Params_size; ++k)
+        {
+            const float gk = g[k] * scale;
+            adam_m[k] = beta1 * adam_m[k] + (1 - beta1) * gk;
+            adam_v[k] = beta2 * adam_v[k] + (1 - beta2) * gk * gk;
+            params[k] -= lr * adam_m[k] / (sqrt(adam_v[k]) + eps);
+        }
+
+        //          int8
+        for (int k = W2; k < W2 + Nnue_l2 * Nnue_l1; ++k)
+            params[k] = clamp(params[k], -Max_weight, Max_weight);
+        for (int k = W3; k < W3 + Nnue_l2; ++k)
+            params[k] = clamp(params[k], -Max_weight, Max_weight);
+
+        double res = 0;
+        for (double loss : losses)
+            res += loss;
+        return res;
+    }
+
+    //    
+    struct activations
+    {
+        alignas(32) float a1[Nnue_l1];
+        alignas(32) float h1[Nnue_l1];
+        alignas(32) float a2[Nnue_l2];
+        alignas(32) float h2[Nnue_l2];
+        float out;
+    };
+
+    //  forward -      rec ( -   )
+    void forward(const record& rec, activations& act) const
+    {
+        const float* p = params.data();
+        copy(p + B1, p + B1 + Nnue_l1, act.a1);
+        for (int f = 0; f < rec.features_num; ++f)
+            add(act.a1, p + W1 + rec.features[f] * Nnue_l1, Nnue_l1);
+        for (int j = 0; j < Nnue_l1; ++j)
+            act.h1[j] = clamp(act.a1[j], 0.0f, 1.0f);
+        for (int k = 0; k < Nnue_l2; ++k)
+        {
+            act.a2[k] = p[B2 + k] + dot(p + W2 + k * Nnue_l1, act.h1, Nnue_l1);
+            act.h2[k] = clamp(act.a2[k], 0.0f, 1.0f);
+        }
+        act.out = p[B3] + dot(p + W3, act.h2, Nnue_l2);
+    }
+
+    //  loss -      
+    static float loss(const float out, const float result, float& prob)
+    {
+        prob = 1 / (1 + exp(-out));
+        return (prob - result) * (prob - result);
+    }
+
+    //  backward        rec,
+    //     g   
+    float backward(const record& rec, float* g) const
+    {
+        const float* p = params.data();
+        activations act;
+        forward(rec, act);
+        float prob;
+        const float err = loss(act.out, rec.result, prob);
+
+        //     
+        const float d_out = 2 * (prob - rec.result) * prob * (1 - prob);
+        g[B3] += d_out;
+        add_scaled(g + W3, act.h2, d_out, Nnue_l2);
+
+        //  :   ,     
+        alignas(32) float d_h1[Nnue_l1] = {};
+        for (int k = 0; k < Nnue_l2; ++k)
+        {
+            if (act.a2[k] <= 0 || act.a2[k] >= 1)
+                continue;
+            const float d_a2 = d_out * p[W3 + k];
+            g[B2 + k] += d_a2;
+            add_scaled(g + W2 + k * Nnue_l1, act.h1, d_a2, Nnue_l1);
+            add_scaled(d_h1, p + W2 + k * Nnue_l1, d_a2, Nnue_l1);
+        }
+
+        //  :       
+        for (int j = 0; j < Nnue_l1; ++j)
+        {
+            if (act.a1[j] <= 0 || act.a1[j] >= 1)
+                d_h1[j] = 0;
+        }
+        add(g + B1, d_h1, Nnue_l1);
+        for (int f = 0; f < rec.features_num; ++f)
+            add(g + W1 + rec.features[f] * Nnue_l1, d_h1, Nnue_l1);
+        return err;
+    }
+
+    //  validation_loss       ()
+    double validation_loss() const
+    {
+        vector<double> losses(threads_num, 0);
+        auto worker = [&](const unsigned t) {
+            activations act;
+            float prob;
+            const size_t begin = validation.size() * t / threads_num;
+            const size_t end = validation.size() * (t + 1) / threads_num;
+            for (size_t i = begin; i < end; ++i)
+            {
+                forward(validation[i], act);
+                losses[t] += loss(act.out, validation[i].result, prob);
+            }
+        };
+        vector<thread> workers;
+        for (unsigned t = 0; t < threads_num; ++t)
+            workers.emplace_back(worker, t);
+        for (auto& th : workers)
+            th.join();
+        double res = 0;
+        for (double l : losses)
+            res += l;
+        return res / validation.size();
+    }
+
+    //  export_network      (. Nnue):
+    //  [0, 1]  [0, Nnue_activation_max],    
+    //    Nnue_weight_scale
+    unique_ptr<Nnue> export_network() const
+    {
+        auto net = make_unique<Nnue>();
+        const float act = float(Nnue_activation_max);
+        const float out = float(Nnue_output_scale);
+        for (int j = 0; j < Nnue_l1; ++j)
+            net->b1[j] = quantize<int16_t>(params[B1 + j] * act);
+        for (int f = 0; f < Nnue_inputs; ++f)
+        {
+            for (int j = 0; j < Nnue_l1; ++j)
+                net->w1[f][j] = quantize<int16_t>(params[W1 + f * Nnue_l1 + j] * act);
+        }
+        for (int k = 0; k < Nnue_l2; ++k)
+        {
+            net->b2[k] = quantize<int32_t>(params[B2 + k] * out);
+            for (int j = 0; j < Nnue_l1; ++j)
+                net->w2[k][j] = quantize<int8_t>(params[W2 + k * Nnue_l1 + j] * Nnue_weight_scale);
+            net->w3[k] = quantize<int8_t>(params[W3 + k] * Nnue_weight_scale);
+        }
+        net->b3 = quantize<int32_t>(params[B3] * out);
+        return net;
+    }
+
+    //  quantize        T
+    template <class T> static T quantize(const float value)
+    {
+        const double lo = numeric_limits<T>::min(), hi = numeric_limits<T>::max();
+        return T(clamp(double(lround(value)), lo, hi));
+    }
+
+    //  add   dst  src (n  8)
+    static void add(float* dst, const float* src, const int n)
+    {
+#ifdef __AVX2__
+        for (int j = 0; j < n; j += 8)
+            _mm256_storeu_ps(dst + j, _mm256_add_ps(_mm256_loadu_ps(dst + j), _mm256_loadu_ps(src + j)));
+#else
+        for (int j = 0; j < n; ++j)
+            dst[j] += src[j];
+#endif
+    }
+
+    //  add_scaled   dst  src,   s (n  8)
+    static void add_scaled(float* dst, const float* src, const float s, const int n)
+    {
+#ifdef __AVX2__
+        const __m256 vs = _mm256_set1_ps(s);
+        for (int j = 0; j < n; j += 8)
+        {
+            __m256 v = _mm256_mul_ps(_mm256_loadu_ps(src + j), vs);
+            _mm256_storeu_ps(dst + j, _mm256_add_ps(_mm256_loadu_ps(dst + j), v));
+        }
+#else
+        for (int j = 0; j < n; ++j)
+            dst[j] += s * src[j];
+#endif
+    }
+
+    //  dot -     n (n  8)
+    static float dot(const float* a, const float* b, const int n)
+    {
+#ifdef __AVX2__
+        __m256 sum = _mm256_setzero_ps();
+        for (int j = 0; j < n; j += 8)
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a + j), _mm256_loadu_ps(b + j)));
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+        return _mm_cvtss_f32(s);
+#else
+        float sum = 0;
+        for (int j = 0; j < n; ++j)
+            sum += a[j] * b[j];
+        return sum;
+#endif
+    }
+
+private:
+    //  ,      Adam
+    vector<float> params;
+    vector<vector<float>> grads;
+    vector<float> adam_m, adam_v;
+    int step = 0;
+
+    //         
+    vector<record> validation;
+    size_t record_index = 0;
+
+    //  
+    string data_path;
+    string network_path;
+    unsigned threads_num;
+    int epochs;
+    size_t batch_size;
+    size_t chunk_size;
+    float learning_rate;
+    size_t validation_every;
+    size_t max_validation;
+    unsigned seed;
+};
@@ -0,0 +1,383 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../Engine/Eval_cache.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "../Engine/Transposition_table.h"
+#include "Config.h"
+
+//  Server -          .
+//   Unix-      JSON lines (  JSON  ):
+//   {"id": 1, "fen": "W:W21-32:B1-12", "depth": 12, "time_ms": 500, "info": true}
+//   {"cancel": 1}
+// id -  ,   ; depth -  , time_ms - 
+//      (   ); info -    .
+//     ,      Logic,
+//    (  ,   )   ,  
+//     .     :
+//     ,       .
+//  -  JSON lines:
+//   {"id": 1, "type": "info", "depth": 5, "score": 1.0, "nodes": 7365, "time_ms": 4, "pv": ["22-17", ...]}
+//   {"id": 1, "type": "result", "status": "ok", "move": "22-17", "depth": 9, "score": 1.0, ...}
+//   {"id": 1, "type": "error", "message": "..."}
+// status : "ok", "timeout" (     )  "cancelled".
+//    ( JSON,    ,  FEN)    "error",
+//      .   id,  id 
+//    ,  ("duplicate id").  ,  
+// (     ),   "error"  message "unknown id".
+class Server
+{
+public:
+    //       "Server" 
+    Server(Config* config)
+    {
+        settings = config->bot_settings((*config)("Server", "Engine"));
+        socket_path = project_path + string((*config)("Server", "SocketPath"));
+        threads_num = (*config)("Server", "Threads");
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        max_depth = (*config)("Server", "MaxDepth");
+        default_time_ms = (*config)("Server", "DefaultTimeMS");
+
+        //         
+        const size_t hash_mb = (*config)("Server", "HashSizeMB");
+        if (hash_mb)
+            tt = make_shared<Transposition_table>(hash_mb);
+        if (settings.eval_cache_mb)
+            eval_cache = make_shared<Eval_cache>(settings.eval_cache_mb);
+        settings.hash_mb = 0;
+        settings.eval_cache_mb = 0;
+    }
+
+    //  run      .  1   .
+    int run()
+    {
+        const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (listener < 0 || socket_path.size() >= sizeof(addr.sun_path))
+        {
+            cerr << "Can't create socket " << socket_path << endl;
+            return 1;
+        }
+        socket_path.copy(addr.sun_path, socket_path.size());
+
+        //  ,    , 
+        unlink(socket_path.c_str());
+        if (bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listener, 64) != 0)
+        {
+            cerr << "Can't listen on " << socket_path << endl;
+            close(listener);
+            return 1;
+        }
+        cout << "Listening on " << socket_path << ", " << threads_num << " threads" << endl;
+
+        for (unsigned i = 0; i < threads_num; ++i)
+            thread(&Server::worker, this).detach();
+        while (true)
+        {
+            const int fd = accept(listener, nullptr, nullptr);
+            if (fd < 0)
+                continue;
+            auto conn = make_shared<connection>();
+            conn->fd = fd;
+            thread(&Server::reader, this, conn).detach();
+        }
+    }
+
+private:
+    struct request;
+
+    //  .  ,       .
+    struct connection
+    {
+        int fd = -1;
+        atomic<bool> open{ true };
+        mutex write_guard;
+
+        //  ,     ( )
+        mutex requests_guard;
+        map<string, weak_ptr<request>> requests;
+
+        ~connection()
+        {
+            if (fd >= 0)
+                close(fd);
+        }
+    };
+
+    //  
+    struct request
+    {
+        json id;
+        string key;
+        shared_ptr<connection> conn;
+        vector<vector<POS_T>> mtx;
+        bool color = false;
+        int depth = 0;
+        bool info = false;
+        chrono::steady_clock::time_point received;
+        chrono::steady_clock::time_point deadline = chrono::steady_clock::time_point::max();
+
+        //  :     Logic::stop_flag
+        atomic<bool> cancelled{ false };
+    };
+
+    //  reader -  :   ,    
+    //      cancel    
+    void reader(shared_ptr<connection> conn)
+    {
+        string buffer;
+        char chunk[4096];
+        ssize_t got;
+        while ((got = recv(conn->fd, chunk, sizeof(chunk), 0)) > 0)
+        {
+            buffer.append(chunk, size_t(got));
+            size_t end;
+            while ((end = buffer.find('\n')) != string::npos)
+            {
+                const string line = buffer.substr(0, end);
+                buffer.erase(0, end + 1);
+                if (line.find_first_not_of(" \t\r") == string::npos)
+                    continue;
+                //        
+                try
+                {
+                    handle(conn, line);
+                }
+                catch (const exception& e)
+                {
+                    send(conn, { { "id", nullptr }, { "type", "error" }, { "message", e.what() } });
+                }
+            }
+        }
+
+        //  :      
+        conn->open = false;
+        lock_guard<mutex> lock(conn->requests_guard);
+        for (auto& [key, weak] : conn->requests)
+        {
+            if (auto req = weak.lock())
+                req->cancelled = true;
+        }
+    }
+
+    //  handle    line  conn
+    void handle(const shared_ptr<connection>& conn, const string& line)
+    {
+        json msg = json::parse(line, nullptr, false);
+        if (msg.is_discarded() || !msg.is_object())
+        {
+            send(conn, { { "id", nullptr }, { "type", "error" }, { "message", "invalid json" } });
+            return;
+        }
+
+        //  :      ,  - 
+        if (msg.contains("cancel"))
+        {
+            shared_ptr<request> req;
+            {
+                lock_guard<mutex> lock(conn->requests_guard);
+                auto it = conn->requests.find(msg["cancel"].dump());
+                if (it != conn->requests.end())
+                    req = it->second.lock();
+            }
+            if (req)
+                req->cancelled = true;
+            else
+                send(conn, { { "id", msg["cancel"] }, { "type", "error" }, { "message", "unknown id" } });
+            return;
+        }
+
+        const json id = msg.value("id", json());
+
+        //     : fen - , depth  time_ms -  , info - 
+        for (const char* name : { "fen", "depth", "time_ms", "info" })
+        {
+            if (!msg.contains(name))
+                continue;
+            const json& field = msg[name];
+            const bool valid = name[0] == 'f' ? field.is_string()
+                                              : (name[0] == 'i' ? field.is_boolean() : field.is_number_integer());
+            if (!valid)
+            {
+                send(conn, { { "id", id }, { "type", "error" }, { "message", string("invalid ") + name } });
+                return;
+            }
+        }
+
+        auto req = make_shared<request>();
+        req->id = id;
+        req->key = id.dump();
+        req->conn = conn;
+        req->received = chrono::steady_clock::now();
+        const string fen = msg.value("fen", string());
+        if (fen.empty() || !Notation::parse_fen(fen, req->mtx, req->color))
+        {
+            send(conn, { { "id", req->id }, { "type", "error" }, { "message", "invalid fen" } });
+            return;
+        }
+        req->depth = int(clamp<int64_t>(msg.value("depth", int64_t(0)), 0, max_depth));
+        int time_ms = int(clamp<int64_t>(msg.value("time_ms", int64_t(0)), 0, INT32_MAX));
+        if (req->depth <= 0 && time_ms <= 0)
+            time_ms = default_time_ms;
+        if (req->depth <= 0)
+            req->depth = max_depth;
+        if (time_ms > 0)
+            req->deadline = req->received + chrono::milliseconds(time_ms);
+        req->info = msg.value("info", false);
+
+        // id   :       
+        bool duplicate;
+        {
+            lock_guard<mutex> lock(conn->requests_guard);
+            auto& entry = conn->requests[req->key];
+            duplicate = !entry.expired();
+            if (!duplicate)
+                entry = req;
+        }
+        if (duplicate)
+        {
+            send(conn, { { "id", req->id }, { "type", "error" }, { "message", "duplicate id" } });
+            return;
+        }
+        {
+            lock_guard<mutex> lock(queue_guard);
+            queue.push_back(req);
+        }
+        queue_cv.notify_one();
+    }
+
+    //  worker -   :      
+    void worker()
+    {
+        Logic logic(settings);
+        logic.tt = tt;
+        logic.eval_cache = eval_cache;
+        while (true)
+        {
+            shared_ptr<request> req;
+            {
+                unique_lock<mutex> lock(queue_guard);
+                queue_cv.wait(lock, [&] { return !queue.empty(); });
+                req = queue.front();
+                queue.pop_front();
+            }
+            analyze(logic, *req);
+            lock_guard<mutex> lock(req->conn->requests_guard);
+            auto it = req->conn->requests.find(req->key);
+            if (it != req->conn->requests.end() && it->second.lock() == req)
+                req->conn->requests.erase(it);
+        }
+    }
+
+    //  analyze             
+    void analyze(Logic& logic, request& req)
+    {
+        json result = { { "id", req.id }, { "type", "result" } };
+        if (!req.conn->open)
+            return;
+        logic.stop_flag = &req.cancelled;
+        logic.deadline = req.deadline;
+        logic.nodes = 0;
+
+        vector<move_pos> best;
+        bool finished = false;
+        //  ,      
+        for (int level = 1; level <= req.depth && !req.cancelled && chrono::steady_clock::now() < req.deadline; ++level)
+        {
+            logic.Max_depth = level;
+            double score;
+            const auto turn = logic.find_best_turns(req.mtx, req.color, &score);
+            //     
+            if (logic.aborted)
+                break;
+            finished = true;
+            //   -  
+            if (turn.empty())
+                break;
+            best = turn;
+            json pv = json::array();
+            for (const auto& full_turn : logic.principal_variation(req.mtx, req.color, turn))
+                pv.push_back(Notation::turn_to_string(full_turn));
+            result["depth"] = level;
+            result["score"] = score;
+            result["pv"] = pv;
+            if (req.info)
+            {
+                send(req.conn, { { "id", req.id }, { "type", "info" }, { "depth", level }, { "score", score },
+                                 { "nodes", logic.nodes }, { "time_ms", elapsed_ms(req) }, { "pv", pv } });
+            }
+            //       
+            if (score == 0 || score >= INF)
+                break;
+        }
+        logic.stop_flag = nullptr;
+
+        result["status"] = req.cancelled ? "cancelled" : (finished ? "ok" : "timeout");
+        result["move"] = best.empty() ? json() : json(Notation::turn_to_string(best));
+        result["nodes"] = logic.nodes;
+        result["time_ms"] = elapsed_ms(req);
+        send(req.conn, result);
+    }
+
+    //  elapsed_ms -      
+    static int64_t elapsed_ms(const request& req)
+    {
+        return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - req.received).count();
+    }
+
+    //  send   conn   msg.   ,   .
+    static void send(const shared_ptr<connection>& conn, const json& msg)
+    {
+        if (!conn->open)
+            return;
+        const string line = msg.dump() + "\n";
+        lock_guard<mutex> lock(conn->write_guard);
+        size_t sent = 0;
+        while (sent < line.size())
+        {
+            const ssize_t res = ::send(conn->fd, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+            if (res <= 0)
+            {
+                conn->open = false;
+                return;
+            }
+            sent += size_t(res);
+        }
+    }
+
+private:
+    //    
+    engine_settings settings;
+
+    //  
+    string socket_path;
+    unsigned threads_num;
+    int max_depth;
+    int default_time_ms;
+
+    //      
+    shared_ptr<Transposition_table> tt;
+    shared_ptr<Eval_cache> eval_cache;
+
+    //  
+    mutex queue_guard;
+    condition_variable queue_cv;
+    deque<shared_ptr<request>> queue;
+};
@@ -0,0 +1,263 @@
+#pragma once
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "../Engine/Eval_weights.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "../Engine/Training_data.h"
+#include "Config.h"
+
+//  Tuner    "NumberAndPotential"    ( Texel).
+//   -      ,    
+//   sigmoid(k * ).   ,  
+//      .    
+//     .       
+//         .
+class Tuner
+{
+public:
+    //       "Tuner" 
+    Tuner(Config* config) : bot_settings(config->bot_settings())
+    {
+        data_path = project_path + string((*config)("Tuner", "DataPath"));
+        weights_path = bot_settings.weights_path;
+        threads_num = (*config)("Tuner", "Threads");
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        self_play_games = (*config)("Tuner", "SelfPlayGames");
+        search_level = (*config)("Tuner", "SearchLevel");
+        random_plies = (*config)("Tuner", "RandomPlies");
+        iterations = (*config)("Tuner", "Iterations");
+        learning_rate = (*config)("Tuner", "LearningRate");
+        max_turns = (*config)("Game", "MaxNumTurns");
+    }
+
+    //  run   ( ),        .
+    //  0  .
+    int run()
+    {
+        if (self_play_games)
+            self_play();
+
+        load_samples();
+        if (samples.empty())
+        {
+            cout << "No positions in " << data_path << endl;
+            return 1;
+        }
+
+        //     
+        weights.load(weights_path);
+        weights.advance = max(weights.advance, 1e-4);
+        weights.king = max(weights.king, 1.0);
+
+        double grad[2];
+        k = fit_k();
+        cout << samples.size() << " positions, k = " << k << ", error " << error(weights, grad) << endl;
+
+        //      (  ,       )
+        //  Adam
+        double theta[2] = { log(weights.king), log(weights.advance) };
+        double m[2] = {}, v[2] = {};
+        const double beta1 = 0.9, beta2 = 0.999, eps = 1e-8;
+        for (int it = 1; it <= iterations; ++it)
+        {
+            const double err = error(weights, grad);
+            for (int p = 0; p < 2; ++p)
+            {
+                m[p] = beta1 * m[p] + (1 - beta1) * grad[p];
+                v[p] = beta2 * v[p] + (1 - beta2) * grad[p] * grad[p];
+                const double m_hat = m[p] / (1 - pow(beta1, it));
+                const double v_hat = v[p] / (1 - pow(beta2, it));
+                theta[p] -= learning_rate * m_hat / (sqrt(v_hat) + eps);
+            }
+            weights.king = exp(theta[0]);
+            weights.advance = exp(theta[1]);
+            if (it % 100 == 0 || it == iterations)
+            {
+                cout << "Iteration " << it << ": error " << err << ", king " << weights.king << ", advance "
+                     << weights.advance << endl;
+            }
+        }
+
+        if (!weights.save(weights_path))
+        {
+            cout << "Can't save weights to " << weights_path << endl;
+            return 1;
+        }
+        cout << "Weights saved to " << weights_path << endl;
+        return 0;
+    }
+
+private:
+    //  sample -  ,    ,   
+    struct sample
+    {
+        double w, wq, b, bq, w_adv, b_adv;
+        double result;
+    };
+
+    //  self_play  self_play_games       .
+    //  random_plies    ,   .
+    void self_play()
+    {
+        atomic<int> next_game{ 0 };
+        mutex file_guard;
+        auto worker = [&]() {
+            Logic logic(bot_settings);
+            logic.Max_depth = search_level;
+            int game;
+            while ((game = next_game++) < self_play_games)
+            {
+                mt19937 gen(game);
+                vector<vector<vector<POS_T>>> positions;
+                const double result = play_game(logic, gen, positions);
+                lock_guard<mutex> lock(file_guard);
+                Training_data::append_game(data_path, positions, result);
+                if ((game + 1) % 10 == 0)
+                    cout << "Self-play: " << game + 1 << " games" << endl;
+            }
+        };
+        vector<thread> workers;
+        for (unsigned i = 0; i < threads_num; ++i)
+            workers.emplace_back(worker);
+        for (auto& th : workers)
+            th.join();
+    }
+
+    //  play_game      ,   positions
+    //          
+    double play_game(Logic& logic, mt19937& gen, vector<vector<vector<POS_T>>>& positions)
+    {
+        auto mtx = Notation::start_position();
+        positions.push_back(mtx);
+        for (int turn_num = 0; turn_num < max_turns; ++turn_num)
+        {
+            const bool color = turn_num % 2;
+            vector<move_pos> turn;
+            if (turn_num < random_plies)
+            {
+                auto full_turns = logic.find_full_turns(mtx, color);
+                if (!full_turns.empty())
+                    turn = full_turns[gen() % full_turns.size()];
+            }
+            else
+                turn = logic.find_best_turns(mtx, color);
+
+            //    
+            if (turn.empty())
+                return color ? 1 : 0;
+            for (const auto& step : turn)
+                mtx = logic.make_turn(mtx, step);
+            positions.push_back(mtx);
+        }
+        return 0.5;
+    }
+
+    //  load_samples         .
+    // ,       , :   .
+    void load_samples()
+    {
+        samples.clear();
+        for (const auto& pos : Training_data::load(data_path))
+        {
+            board_state st(Training_data::to_matrix(pos));
+            if (st.w + st.wq == 0 || st.b + st.bq == 0)
+                continue;
+            samples.push_back({ double(st.w), double(st.wq), double(st.b), double(st.bq), double(st.w_adv),
+                                double(st.b_adv), pos.result });
+        }
+    }
+
+    //  error        wt
+    //           (grad[0], grad[1]).
+    //     ,     .
+    double error(const eval_weights& wt, double* grad) const
+    {
+        vector<array<double, 3>> sums(threads_num, array<double, 3>{});
+        auto worker = [&](const unsigned t) {
+            const size_t from = samples.size() * t / threads_num;
+            const size_t to = samples.size() * (t + 1) / threads_num;
+            double err = 0, g_king = 0, g_adv = 0;
+            for (size_t i = from; i < to; ++i)
+            {
+                const sample& s = samples[i];
+                const double white = s.w + wt.advance * s.w_adv + wt.king * s.wq;
+                const double black = s.b + wt.advance * s.b_adv + wt.king * s.bq;
+                const double p = 1 / (1 + exp(-k * log(white / black)));
+                const double d = p - s.result;
+                err += d * d;
+
+                //    ,    
+                const double common = 2 * d * p * (1 - p) * k;
+                g_king += common * (s.wq / white - s.bq / black) * wt.king;
+                g_adv += common * (s.w_adv / white - s.b_adv / black) * wt.advance;
+            }
+            sums[t] = { err, g_king, g_adv };
+        };
+        vector<thread> workers;
+        for (unsigned t = 0; t < threads_num; ++t)
+            workers.emplace_back(worker, t);
+        for (auto& th : workers)
+            th.join();
+
+        double total[3] = {};
+        for (const auto& s : sums)
+        {
+            for (int p = 0; p < 3; ++p)
+                total[p] += s[p];
+        }
+        grad[0] = total[1] / samples.size();
+        grad[1] = total[2] / samples.size();
+        return total[0] / samples.size();
+    }
+
+    //  fit_k   k      
+    double fit_k()
+    {
+        double grad[2];
+        double lo = 0.01, hi = 20;
+        const double ratio = (sqrt(5.0) - 1) / 2;
+        for (int it = 0; it < 40; ++it)
+        {
+            const double k1 = hi - ratio * (hi - lo);
+            const double k2 = lo + ratio * (hi - lo);
+            k = k1;
+            const double e1 = error(weights, grad);
+            k = k2;
+            const double e2 = error(weights, grad);
+            if (e1 < e2)
+                hi = k2;
+            else
+                lo = k1;
+        }
+        return (lo + hi) / 2;
+    }
+
+private:
+    //    
+    vector<sample> samples;
+
+    //       sigmoid
+    eval_weights weights;
+    double k = 1;
+
+    //  
+    string data_path;
+    string weights_path;
+    unsigned threads_num;
+    int self_play_games;
+    int search_level;
+    int random_plies;
+    int iterations;
+    double learning_rate;
+    int max_turns;
+
+    //       
+    engine_settings bot_settings;
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+
+//     ( "BotScoringType")
+enum class BotScoringType
+{
+    NumberOnly, //   
+    NumberAndPotential, //     
+    Network, //   (   "NetworkPath")
+    Patterns //     (  "PatternsPath"   )
+};
+
+//    ( "Optimization")
+enum class Optimization
+{
+    O0, //  
+    O1, // - 
+    O2 //    O1
+};
+
+//        BotScoringType
+inline BotScoringType parse_scoring_type(const std::string& name)
+{
+    if (name == "Network")
+        return BotScoringType::Network;
+    if (name == "Patterns")
+        return BotScoringType::Patterns;
+    return name == "NumberAndPotential" ? BotScoringType::NumberAndPotential : BotScoringType::NumberOnly;
+}
+
+//        Optimization
+inline Optimization parse_optimization(const std::string& name)
+{
+    if (name == "O0")
+        return Optimization::O0;
+    return name == "O2" ? Optimization::O2 : Optimization::O1;
+}
@@ -0,0 +1,300 @@
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+#include "../Engine/Pdn.h"
+#include "../Engine/Transposition_table.h"
+
+//  :      PDN    
+// (   ,  ,    ),  
+//     PDN        .
+//     ,         (  ),
+//    "?" (),           Blunder_margin.
+//    ;      
+// ,         .
+//      .
+class Annotator
+{
+public:
+    Annotator(const int max_level, const int time_ms, const BotScoringType scoring, const size_t hash_mb)
+        : max_level(max_level), time_limit(time_ms), hash_mb(hash_mb)
+    {
+        settings.no_random = true;
+        settings.weights_path.clear();
+        settings.scoring_type = scoring;
+        rules = make_unique<Logic>(settings);
+    }
+
+    //  run    input  threads_num       output.
+    //  false,     .
+    bool run(const string& input, const string& output, unsigned threads_num)
+    {
+        if (!reader.open(input))
+        {
+            cerr << "Cannot open " << input << endl;
+            return false;
+        }
+        output_path = output;
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+
+        const auto start = chrono::steady_clock::now();
+        vector<thread> workers;
+        for (unsigned i = 0; i < threads_num; ++i)
+            workers.emplace_back(&Annotator::worker, this);
+        for (auto& th : workers)
+            th.join();
+        const double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        cout << "Games: " << written << " annotated, " << errors << " with errors" << endl;
+        cout << "Positions: " << positions_done << ", blunders: " << blunders << endl;
+        cout << "Time (ms): " << int(sec * 1000) << ", positions/second: " << size_t(positions_done / max(sec, 1e-9))
+             << endl;
+        return true;
+    }
+
+private:
+    //   ,             
+    static constexpr double Blunder_margin = 0.1;
+
+    //   :  ,    ,   
+    //       (-1,    )
+    struct position_result
+    {
+        string best;
+        double score = -1;
+        int depth = 0;
+        double played = -1;
+    };
+
+    //   : ,  ,       ,
+    //     ,       
+    struct game_job
+    {
+        size_t index = 0;
+        vector<pair<string, string>> tags;
+        string result;
+        bool first_color = false;
+        vector<vector<move_pos>> turns;
+        vector<vector<vector<POS_T>>> positions;
+        vector<position_result> results;
+        vector<string> notes;
+        shared_ptr<Transposition_table> tt;
+        size_t next = 0;
+        atomic<size_t> remaining{ 0 };
+    };
+
+    //  worker -   :   ,    ,
+    //      -      
+    void worker()
+    {
+        Logic logic(settings);
+        shared_ptr<game_job> job;
+        size_t index;
+        while (take(job, index))
+        {
+            logic.tt = job->tt;
+            const bool color = job->first_color ^ (index % 2);
+            auto& res = job->results[index];
+            res = search(logic, job->positions[index], color);
+
+            //         
+            if (res.depth && Notation::turn_to_string(job->turns[index]) != res.best)
+            {
+                logic.deadline = chrono::steady_clock::time_point::max();
+                logic.Max_depth = max(1, res.depth - 1);
+                double score;
+                logic.find_best_turns(job->positions[index + 1], !color, &score);
+                res.played = score <= 0 ? INF : (score >= INF ? 0 : 1 / score);
+            }
+            if (--job->remaining == 0)
+                complete(job);
+        }
+    }
+
+    //  take   :   ,     , -
+    //    .  false,   .
+    bool take(shared_ptr<game_job>& job, size_t& index)
+    {
+        lock_guard<mutex> lock(input_guard);
+        while (!current || current->next == current->turns.size())
+        {
+            pdn_game game;
+            if (!reader.next_game(game))
+                return false;
+            current = load(game);
+        }
+        job = current;
+        index = current->next++;
+        return true;
+    }
+
+    //  load   game      .
+    //    ,      (   ).
+    shared_ptr<game_job> load(const pdn_game& game)
+    {
+        auto job = make_shared<game_job>();
+        job->index = games_read++;
+        Pdn_replay replay(*rules, game);
+        job->first_color = replay.color;
+        job->positions.push_back(replay.st.to_matrix());
+        while (replay.next())
+        {
+            job->turns.push_back(replay.turn);
+            job->positions.push_back(replay.st.to_matrix());
+        }
+        if (!replay.error.empty())
+        {
+            cerr << "Game " << job->index + 1 << ": " << replay.error << endl;
+            job->turns.clear();
+            lock_guard<mutex> lock(output_guard);
+            ++errors;
+            finished[job->index] = nullptr;
+            flush();
+            return job;
+        }
+        job->tags = game.tags();
+        job->tags.emplace_back("Annotator", "Checkers level " + to_string(max_level));
+        job->result = game.result.empty() ? string(game.tag("Result")) : string(game.result);
+        if (job->result.empty())
+            job->result = "*";
+        job->results.resize(job->turns.size());
+        job->remaining = job->turns.size();
+        if (job->turns.empty())
+        {
+            lock_guard<mutex> lock(output_guard);
+            finished[job->index] = job;
+            flush();
+            return job;
+        }
+        if (hash_mb)
+            job->tt = make_shared<Transposition_table>(hash_mb);
+        return job;
+    }
+
+    //  search     mtx     max_level    
+    position_result search(Logic& logic, const vector<vector<POS_T>>& mtx, const bool color) const
+    {
+        position_result res;
+        const auto start = chrono::steady_clock::now();
+        logic.deadline = time_limit > 0 ? start + chrono::milliseconds(time_limit) : chrono::steady_clock::time_point::max();
+        for (int level = 1; level <= max_level; ++level)
+        {
+            logic.Max_depth = level;
+            double score;
+            const auto turn = logic.find_best_turns(mtx, color, &score);
+            //     
+            if (logic.aborted)
+                break;
+            res.best = Notation::turn_to_string(turn);
+            res.score = score;
+            res.depth = level;
+            if (turn.empty() || score == 0 || score >= INF)
+                break;
+        }
+        return res;
+    }
+
+    //  complete   job,    ,    
+    void complete(const shared_ptr<game_job>& job)
+    {
+        job->tt.reset();
+        auto& notes = job->notes;
+        notes.assign(job->turns.size(), string());
+        size_t game_blunders = 0;
+        for (size_t k = 0; k < job->turns.size(); ++k)
+        {
+            const auto& before = job->results[k];
+            if (!before.depth)
+                continue;
+            ostringstream note;
+            if (before.played >= 0 && before.played * (1 + Blunder_margin) < before.score)
+            {
+                note << '?';
+                ++game_blunders;
+            }
+            note << " {eval ";
+            if (before.score >= INF)
+                note << "win";
+            else if (before.score == 0)
+                note << "loss";
+            else
+                note << fixed << setprecision(3) << before.score;
+            note << ", best " << before.best << ", depth " << before.depth << '}';
+            notes[k] = note.str();
+        }
+
+        lock_guard<mutex> lock(output_guard);
+        positions_done += job->turns.size();
+        blunders += game_blunders;
+        finished[job->index] = job;
+        flush();
+    }
+
+    //  flush   ,     .
+    //   output_guard.
+    void flush()
+    {
+        for (auto it = finished.begin(); it != finished.end() && it->first == next_to_write; it = finished.erase(it))
+        {
+            if (it->second)
+            {
+                const auto& job = *it->second;
+                if (!Pdn_writer::append_game(output_path, job.tags, job.turns, job.first_color, job.result,
+                                             job.notes))
+                    cerr << "Cannot write " << output_path << endl;
+                ++written;
+            }
+            ++next_to_write;
+        }
+    }
+
+private:
+    engine_settings settings;
+    int max_level;
+    int time_limit;
+    size_t hash_mb;
+
+    //  : ,       ,   
+    mutex input_guard;
+    Pdn_reader reader;
+    unique_ptr<Logic> rules;
+    shared_ptr<game_job> current;
+    size_t games_read = 0;
+
+    // : ,    (   ),  
+    mutex output_guard;
+    string output_path;
+    map<size_t, shared_ptr<game_job>> finished;
+    size_t next_to_write = 0;
+    size_t written = 0, errors = 0, positions_done = 0, blunders = 0;
+};
+
+// : Annotate < PDN> <  PDN> [=8] [  , =0 ( )]
+// [ =0 (  )] [ ] [  , =16]
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        cerr << "Usage: Annotate <games.pdn> <output.pdn> [level] [time per position, ms] [threads] [scoring] [hash MB]"
+             << endl;
+        return 1;
+    }
+    const int max_level = argc > 3 ? stoi(argv[3]) : 8;
+    const int time_ms = argc > 4 ? stoi(argv[4]) : 0;
+    const unsigned threads = argc > 5 ? stoul(argv[5]) : 0;
+    const BotScoringType scoring = argc > 6 ? parse_scoring_type(argv[6]) : BotScoringType::NumberAndPotential;
+    const size_t hash_mb = argc > 7 ? stoul(argv[7]) : 16;
+
+    Annotator annotator(max_level, time_ms, scoring, hash_mb);
+    return annotator.run(argv[1], argv[2], threads) ? 0 : 1;
+}
@@ -0,0 +1,64 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "../Engine/Bench_positions.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+
+//   :        .
+// : Bench [ ] [ ] [ FEN].   ,     .       ,
+//  , ,  (  )   -   .
+//      ,      .
+int main(int argc, char* argv[])
+{
+    const int level = argc > 1 ? stoi(argv[1]) : 8;
+    engine_settings settings;
+    settings.no_random = true;
+
+    //    ,          
+    settings.weights_path.clear();
+    if (argc > 2)
+        settings.scoring_type = parse_scoring_type(argv[2]);
+
+    //  :       
+    vector<pair<vector<vector<POS_T>>, bool>> positions;
+    if (argc > 3)
+    {
+        positions.emplace_back();
+        if (!Notation::parse_fen(argv[3], positions[0].first, positions[0].second))
+        {
+            cerr << "Invalid FEN: " << argv[3] << endl;
+            return 1;
+        }
+    }
+    else
+    {
+        for (const auto& pos : Bench_positions)
+            positions.emplace_back(pos.to_matrix(), pos.color);
+    }
+
+    Logic logic(settings);
+    logic.Max_depth = level;
+    size_t total_nodes = 0, total_cutoffs = 0, total_first_cutoffs = 0;
+    double total_ms = 0;
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        const auto& mtx = positions[i].first;
+        logic.reset_stats();
+        auto start = chrono::steady_clock::now();
+        logic.find_best_turns(mtx, positions[i].second);
+        const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << "Position " << i + 1 << ": " << logic.nodes << " nodes, " << ms << " ms" << endl;
+        total_nodes += logic.nodes;
+        total_cutoffs += logic.beta_cutoffs;
+        total_first_cutoffs += logic.first_move_cutoffs;
+        total_ms += ms;
+    }
+    cout << "Total time (ms): " << int(total_ms) << endl;
+    cout << "Nodes searched: " << total_nodes << endl;
+    cout << "Nodes/second: " << size_t(total_nodes / (total_ms / 1000)) << endl;
+    cout << "Beta cutoffs: " << total_cutoffs << ", on the first move: "
+         << (total_cutoffs ? 100 * total_first_cutoffs / total_cutoffs : 0) << "%" << endl;
+    return 0;
+}
@@ -0,0 +1,10 @@
+#include "../Game/Book_builder.h"
+
+//   :     "Book"  settings.json.
+//      -   .
+int main(int argc, char* argv[])
+{
+    Config config;
+    Book_builder builder(&config);
+    return builder.run();
+}
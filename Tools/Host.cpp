@@ -0,0 +1,10 @@
+#include "../Game/Host.h"
+
+//           ( "Host"  settings.json)
+//     .
+int main(int argc, char* argv[])
+{
+    Config config;
+    Host host(&config);
+    return host.run();
+}
@@ -0,0 +1,445 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+
+//   ,      (   )
+//      Hub  stdin/stdout.
+//   ( -  =,      ):
+//   hub                          -   id, param ...  wait
+//   init                         -   ready
+//   set-param name=N value=V     - : scoring, eval-cache (), weights, network, patterns
+//   new-game                     -  
+//   pos start | pos pos=P | pos fen=F [moves="22-18 11-15"]
+//                                - : P -   (W  B)  32  (e - ,
+//                                  w, b - , W, B - ), F - FEN  PDN, moves -   
+//   level depth=N | level move-time=S | level time=S [inc=S] | level infinite
+//                                -  : ,   ,   
+//                                  (     1/30   inc)
+//   go think | go analyze        - ; analyze   stop
+//   stop                         -        
+//   ping                         -   pong
+//   quit                         - 
+//        
+//   info depth=D score=S nodes=N time=T nps=V pv="..."
+// (S -     , 1 - ),   - done move=M.
+//     ,  ,    stop,     .
+class Hub
+{
+public:
+    //    ,      
+    Hub()
+    {
+        settings.no_random = true;
+    }
+
+    //  run      quit   
+    int run()
+    {
+        string line;
+        while (getline(cin, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            vector<pair<string, string>> args;
+            const string command = parse(line, args);
+            if (command.empty())
+                continue;
+            if (command == "quit")
+                break;
+            execute(command, args);
+        }
+        stop_search();
+        return 0;
+    }
+
+private:
+    //  execute   command   args
+    void execute(const string& command, const vector<pair<string, string>>& args)
+    {
+        if (command == "hub")
+        {
+            say("id name=Checkers version=1.0");
+            say("param name=scoring value=" + scoring_name() +
+                " type=enum values=\"NumberOnly NumberAndPotential Network Patterns\"");
+            say("param name=eval-cache value=" + to_string(settings.eval_cache_mb) + " type=int min=0 max=4096");
+            say("param name=weights value=\"" + settings.weights_path + "\" type=string");
+            say("param name=network value=\"" + settings.network_path + "\" type=string");
+            say("param name=patterns value=\"" + settings.patterns_path + "\" type=string");
+            say("wait");
+        }
+        else if (command == "init")
+        {
+            stop_search();
+            logic.reset();
+            make_logic();
+            say("ready");
+        }
+        else if (command == "ping")
+            say("pong");
+        else if (command == "set-param")
+            set_param(arg(args, "name"), arg(args, "value"));
+        else if (command == "new-game")
+        {
+            stop_search();
+            mtx = Notation::start_position();
+            color = false;
+        }
+        else if (command == "pos")
+            set_position(args);
+        else if (command == "level")
+            set_level(args);
+        else if (command == "go")
+        {
+            stop_search();
+            const bool analyze = has(args, "analyze") || has(args, "ponder");
+            stop = false;
+            searcher = thread(&Hub::think, this, mtx, color, analyze);
+        }
+        else if (command == "stop")
+            stop_search();
+        else
+            say("error message=\"unknown command " + command + "\"");
+    }
+
+    //  think        info     done  
+    void think(const vector<vector<POS_T>> position, const bool side, const bool analyze)
+    {
+        make_logic();
+        const auto start = chrono::steady_clock::now();
+        logic->stop_flag = &stop;
+        logic->deadline = chrono::steady_clock::time_point::max();
+        const double move_time = analyze ? 0 : time_for_move();
+        if (move_time > 0)
+            logic->deadline = start + chrono::microseconds(int64_t(move_time * 1e6));
+        const int max_level = (analyze || !depth_limit) ? Max_level : depth_limit;
+        const size_t legal = logic->find_full_turns(position, side).size();
+
+        vector<move_pos> best;
+        size_t nodes = 0;
+        for (int level = 1; level <= max_level && legal; ++level)
+        {
+            logic->Max_depth = level;
+            logic->nodes = 0;
+            double score;
+            const auto turn = logic->find_best_turns(position, side, &score);
+            nodes += logic->nodes;
+            //     
+            if (logic->aborted)
+                break;
+            best = turn;
+            const auto pv = logic->principal_variation(position, side, turn);
+            const double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            string pv_text;
+            for (const auto& full_turn : pv)
+                pv_text += (pv_text.empty() ? "" : " ") + Notation::turn_to_string(full_turn);
+            say("info depth=" + to_string(level) + " score=" + to_string(score) + " nodes=" + to_string(nodes) +
+                " time=" + to_string(sec) + " nps=" + to_string(size_t(nodes / max(sec, 1e-6))) + " pv=\"" + pv_text +
+                "\"");
+            if (analyze)
+                continue;
+
+            //          .
+            //    ,     .
+            if (legal == 1 || score == 0 || score >= INF || (move_time > 0 && sec * 2 > move_time))
+                break;
+        }
+
+        //        stop
+        while (analyze && !stop)
+            this_thread::sleep_for(chrono::milliseconds(1));
+        logic->stop_flag = nullptr;
+        say(best.empty() ? string("done") : "done move=" + Notation::turn_to_string(best));
+    }
+
+    //  time_for_move       (0 -  )
+    double time_for_move() const
+    {
+        if (move_time_limit > 0)
+            return move_time_limit;
+        if (game_time > 0)
+            return game_time / 30 + increment;
+        return 0;
+    }
+
+    //  stop_search    ,     done
+    void stop_search()
+    {
+        stop = true;
+        if (searcher.joinable())
+            searcher.join();
+    }
+
+    //  set_position   pos
+    void set_position(const vector<pair<string, string>>& args)
+    {
+        stop_search();
+        vector<vector<POS_T>> new_mtx;
+        bool new_color = false;
+        if (has(args, "start"))
+            new_mtx = Notation::start_position();
+        else if (has(args, "fen"))
+        {
+            if (!Notation::parse_fen(arg(args, "fen"), new_mtx, new_color))
+            {
+                say("error message=\"invalid fen\"");
+                return;
+            }
+        }
+        else if (!parse_hub_position(arg(args, "pos"), new_mtx, new_color))
+        {
+            say("error message=\"invalid position\"");
+            return;
+        }
+
+        //       
+        make_logic();
+        const string moves = arg(args, "moves");
+        size_t pos = 0;
+        while (pos < moves.size())
+        {
+            size_t end = moves.find(' ', pos);
+            if (end == string::npos)
+                end = moves.size();
+            const string move = moves.substr(pos, end - pos);
+            pos = end + 1;
+            if (move.empty())
+                continue;
+            const auto full_turns = logic->find_full_turns(new_mtx, new_color);
+            const vector<move_pos>* turn = find_turn(full_turns, move);
+            if (!turn)
+            {
+                say("error message=\"illegal move " + move + "\"");
+                return;
+            }
+            for (const auto& step : *turn)
+                new_mtx = logic->make_turn(new_mtx, step);
+            new_color = !new_color;
+        }
+        mtx = new_mtx;
+        color = new_color;
+    }
+
+    //  set_level   level.   ,    
+    //  ;      .
+    void set_level(const vector<pair<string, string>>& args)
+    {
+        stop_search();
+        int new_depth = 0;
+        double new_move_time = 0, new_time = 0, new_increment = 0;
+        try
+        {
+            if (has(args, "depth"))
+                new_depth = max(1, min(Max_level, stoi(arg(args, "depth"))));
+            if (has(args, "move-time"))
+                new_move_time = stod(arg(args, "move-time"));
+            if (has(args, "time"))
+                new_time = stod(arg(args, "time"));
+            if (has(args, "inc"))
+                new_increment = stod(arg(args, "inc"));
+        }
+        catch (const exception&)
+        {
+            say("error message=\"invalid level\"");
+            return;
+        }
+        depth_limit = new_depth;
+        move_time_limit = new_move_time;
+        game_time = new_time;
+        increment = new_increment;
+    }
+
+    //  set_param   ;     
+    void set_param(const string& name, const string& value)
+    {
+        stop_search();
+        try
+        {
+            if (name == "scoring")
+                settings.scoring_type = parse_scoring_type(value);
+            else if (name == "eval-cache")
+                settings.eval_cache_mb = stoul(value);
+            else if (name == "weights")
+                settings.weights_path = value;
+            else if (name == "network")
+                settings.network_path = value;
+            else if (name == "patterns")
+                settings.patterns_path = value;
+            else
+            {
+                say("error message=\"unknown param " + name + "\"");
+                return;
+            }
+        }
+        catch (const exception&)
+        {
+            say("error message=\"invalid value for " + name + "\"");
+            return;
+        }
+        logic.reset();
+    }
+
+    //  make_logic   Logic   ,    
+    void make_logic()
+    {
+        if (!logic)
+            logic = make_unique<Logic>(settings);
+    }
+
+    //  find_turn     full_turns   move:
+    //    ,    ,   .
+    //  nullptr,       .
+    static const vector<move_pos>* find_turn(const vector<vector<move_pos>>& full_turns, const string& move)
+    {
+        const vector<int> squares = Notation::parse_squares(move);
+        if (squares.empty())
+            return nullptr;
+        const vector<move_pos>* found = nullptr;
+        for (const auto& full_turn : full_turns)
+        {
+            const vector<int> turn_squares = Notation::turn_squares(full_turn);
+            const bool same = squares.size() == 2 ? squares.front() == turn_squares.front() &&
+                                                        squares.back() == turn_squares.back()
+                                                  : squares == turn_squares;
+            if (!same)
+                continue;
+            if (found)
+                return nullptr;
+            found = &full_turn;
+        }
+        return found;
+    }
+
+    //  parse_hub_position     Hub:    32 
+    static bool parse_hub_position(const string& text, vector<vector<POS_T>>& new_mtx, bool& new_color)
+    {
+        if (text.size() != 33 || (text[0] != 'W' && text[0] != 'B'))
+            return false;
+        new_color = text[0] == 'B';
+        new_mtx.assign(8, vector<POS_T>(8, 0));
+        const string pieces = "ewbWB";
+        for (int n = 1; n <= 32; ++n)
+        {
+            const size_t type = pieces.find(text[n]);
+            if (type == string::npos)
+                return false;
+            POS_T i, j;
+            Notation::cell(n, i, j);
+            new_mtx[i][j] = POS_T(type);
+        }
+        return true;
+    }
+
+    //  parse   :   ,    args.
+    //   '='    .
+    static string parse(const string& line, vector<pair<string, string>>& args)
+    {
+        vector<string> words;
+        string word;
+        bool quoted = false;
+        for (const char c : line)
+        {
+            if (c == '"')
+                quoted = !quoted;
+            else if ((c == ' ' || c == '\t') && !quoted)
+            {
+                if (!word.empty())
+                    words.push_back(word);
+                word.clear();
+            }
+            else
+                word += c;
+        }
+        if (!word.empty())
+            words.push_back(word);
+        if (words.empty())
+            return "";
+        for (size_t k = 1; k < words.size(); ++k)
+        {
+            const size_t eq = words[k].find('=');
+            if (eq == string::npos)
+                args.emplace_back(words[k], "");
+            else
+                args.emplace_back(words[k].substr(0, eq), words[k].substr(eq + 1));
+        }
+        return words[0];
+    }
+
+    static bool has(const vector<pair<string, string>>& args, const string& name)
+    {
+        for (const auto& a : args)
+        {
+            if (a.first == name)
+                return true;
+        }
+        return false;
+    }
+
+    static string arg(const vector<pair<string, string>>& args, const string& name)
+    {
+        for (const auto& a : args)
+        {
+            if (a.first == name)
+                return a.second;
+        }
+        return "";
+    }
+
+    string scoring_name() const
+    {
+        switch (settings.scoring_type)
+        {
+        case BotScoringType::NumberOnly:
+            return "NumberOnly";
+        case BotScoringType::Network:
+            return "Network";
+        case BotScoringType::Patterns:
+            return "Patterns";
+        default:
+            return "NumberAndPotential";
+        }
+    }
+
+    //  say    ,    
+    void say(const string& text)
+    {
+        lock_guard<mutex> lock(output_guard);
+        cout << text << endl;
+    }
+
+private:
+    //       
+    static constexpr int Max_level = 64;
+
+    engine_settings settings;
+    unique_ptr<Logic> logic;
+
+    //     
+    vector<vector<POS_T>> mtx = Notation::start_position();
+    bool color = false;
+
+    //  :  (0 -  ),   ,       .
+    //    level     8.
+    int depth_limit = 8;
+    double move_time_limit = 0, game_time = 0, increment = 0;
+
+    //      
+    thread searcher;
+    atomic<bool> stop{ false };
+    mutex output_guard;
+};
+
+int main()
+{
+    ios::sync_with_stdio(false);
+    Hub hub;
+    return hub.run();
+}
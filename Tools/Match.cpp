@@ -0,0 +1,10 @@
+#include "../Game/Match.h"
+
+//        ( "Match"  settings.json):
+//     , ,     SPRT   .
+int main(int argc, char* argv[])
+{
+    Config config;
+    Match match(&config);
+    return match.run();
+}
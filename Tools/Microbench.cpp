@@ -0,0 +1,223 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+    #include <intrin.h>
+#endif
+
+#include "../Engine/Bench_positions.h"
+#include "../Engine/Logic.h"
+
+//   :  operator new    
+static atomic<size_t> allocations{ 0 };
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    if (void* p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+//  Microbench          Bench_positions:
+//     (  ),    ,  ,
+//        .    
+//        ,      .
+class Microbench
+{
+public:
+    Microbench()
+    {
+        engine_settings settings;
+        settings.no_random = true;
+        settings.weights_path.clear();
+        logic = make_unique<Logic>(settings);
+
+        //    ,       
+        for (const auto& pos : Bench_positions)
+        {
+            sample s{ board_state(pos.to_matrix()), pos.to_matrix(), pos.color, {} };
+            logic->find_turns(s.color, s.st);
+            s.turns = logic->turns;
+            samples.push_back(s);
+        }
+    }
+
+    //  run   , repeats -     
+    void run(const int repeats)
+    {
+        cout << left << setw(30) << "routine" << right << setw(12) << "calls" << setw(14) << "cycles/call"
+             << setw(12) << "ns/call" << setw(14) << "allocs/call" << endl;
+
+        //    ,      
+        for (const bool kings : { false, true })
+        {
+            measure(kings ? "find_turns (king)" : "find_turns (man)", repeats, [&](size_t& calls) {
+                for (const auto& s : samples)
+                {
+                    for (POS_T i = 0; i < 8; ++i)
+                    {
+                        for (POS_T j = 0; j < 8; ++j)
+                        {
+                            if (!s.st.mtx[i][j] || (s.st.mtx[i][j] > 2) != kings)
+                                continue;
+                            logic->find_turns(i, j, s.st);
+                            sink += logic->turns.size();
+                            ++calls;
+                        }
+                    }
+                }
+            });
+        }
+
+        measure("find_turns (side)", repeats, [&](size_t& calls) {
+            for (const auto& s : samples)
+            {
+                logic->find_turns(s.color, s.st);
+                sink += logic->turns.size();
+                ++calls;
+            }
+        });
+
+        measure("make_turn + unmake_turn", repeats, [&](size_t& calls) {
+            for (auto& s : samples)
+            {
+                for (const auto& turn : s.turns)
+                {
+                    undo_info undo;
+                    s.st.make_turn(turn, undo);
+                    sink += s.st.hash;
+                    s.st.unmake_turn(turn, undo);
+                    ++calls;
+                }
+            }
+        });
+
+        measure("make_turn (matrix)", repeats, [&](size_t& calls) {
+            for (const auto& s : samples)
+            {
+                for (const auto& turn : s.turns)
+                {
+                    sink += logic->make_turn(s.mtx, turn)[turn.x2][turn.y2];
+                    ++calls;
+                }
+            }
+        });
+
+        measure("calc_score (NumberOnly)", repeats, [&](size_t& calls) {
+            for (const auto& s : samples)
+            {
+                sink += size_t(logic->calc_score<BotScoringType::NumberOnly>(s.st, s.color));
+                ++calls;
+            }
+        });
+
+        measure("calc_score (NumberAndPotential)", repeats, [&](size_t& calls) {
+            for (const auto& s : samples)
+            {
+                sink += size_t(logic->calc_score<BotScoringType::NumberAndPotential>(s.st, s.color));
+                ++calls;
+            }
+        });
+
+        measure("Zobrist::hash (full)", repeats, [&](size_t& calls) {
+            for (const auto& s : samples)
+            {
+                sink += Zobrist::hash(s.mtx, s.color);
+                ++calls;
+            }
+        });
+
+        //      -   Zobrist::turn_delta,   board_state::make_turn
+        // (   ),   ,    ,     
+        measure("hash update (per move)", repeats, [&](size_t& calls) {
+            for (const auto& s : samples)
+            {
+                for (const auto& turn : s.turns)
+                {
+                    const POS_T beaten = turn.xb != -1 ? s.st.mtx[turn.xb][turn.yb] : 0;
+                    sink += s.st.hash ^ Zobrist::turn_delta(turn, s.st.mtx[turn.x][turn.y], beaten) ^
+                            Zobrist::side(!s.color);
+                    ++calls;
+                }
+            }
+        });
+    }
+
+    //  ,      
+    size_t sink = 0;
+
+private:
+    //    :  ,  ,     
+    struct sample
+    {
+        board_state st;
+        vector<vector<POS_T>> mtx;
+        bool color;
+        vector<move_pos> turns;
+    };
+
+    //  measure  body repeats  (    )
+    //    ,       
+    void measure(const string& name, const int repeats, const function<void(size_t&)>& body)
+    {
+        size_t calls = 0;
+        body(calls);
+
+        calls = 0;
+        const size_t allocs_before = allocations;
+        const auto start = chrono::steady_clock::now();
+        const uint64_t cycles_before = cycles();
+        for (int r = 0; r < repeats; ++r)
+            body(calls);
+        const uint64_t cycles_total = cycles() - cycles_before;
+        const double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        const size_t allocs = allocations - allocs_before;
+
+        cout << left << setw(30) << name << right << setw(12) << calls << fixed << setprecision(1) << setw(14)
+             << double(cycles_total) / calls << setw(12) << ns / calls << setprecision(3) << setw(14)
+             << double(allocs) / calls << endl;
+    }
+
+    //  cycles     (   - )
+    static uint64_t cycles()
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        return __rdtsc();
+#else
+        return uint64_t(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+private:
+    unique_ptr<Logic> logic;
+    vector<sample> samples;
+};
+
+// : Microbench [   ] (  2000)
+int main(int argc, char* argv[])
+{
+    Microbench bench;
+    bench.run(argc > 1 ? stoi(argv[1]) : 2000);
+    cout << "Checksum: " << bench.sink << endl;
+    return 0;
+}
@@ -0,0 +1,10 @@
+#include "../Game/Nnue_trainer.h"
+
+//        ( "Trainer"  settings.json).
+//         .
+int main(int argc, char* argv[])
+{
+    Config config;
+    Nnue_trainer trainer(&config);
+    return trainer.run();
+}
@@ -0,0 +1,79 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "../Engine/Logic.h"
+#include "../Engine/Pdn.h"
+#include "../Engine/Training_data.h"
+
+//     PDN:         .
+// : Pdn_import < PDN> [ ].    ,   
+//        Training_data (    ).
+//    ,  ,    .
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        cerr << "Usage: Pdn_import <games.pdn> [positions file]" << endl;
+        return 1;
+    }
+    Pdn_reader reader;
+    if (!reader.open(argv[1]))
+    {
+        cerr << "Cannot open " << argv[1] << endl;
+        return 1;
+    }
+    ofstream out;
+    if (argc > 2)
+    {
+        out.open(argv[2], ios_base::app);
+        if (!out.is_open())
+        {
+            cerr << "Cannot open " << argv[2] << endl;
+            return 1;
+        }
+    }
+
+    engine_settings settings;
+    settings.no_random = true;
+    settings.scoring_type = BotScoringType::NumberOnly;
+    Logic rules(settings);
+
+    size_t games = 0, errors = 0, plies = 0, positions = 0;
+    auto write_position = [&](const board_state& st, const double result) {
+        Training_data::write_position(out, st.mtx, result);
+        ++positions;
+    };
+
+    const auto start = chrono::steady_clock::now();
+    pdn_game game;
+    while (reader.next_game(game))
+    {
+        ++games;
+        const double result = game.white_score();
+        const bool write = out.is_open() && result >= 0;
+        Pdn_replay replay(rules, game);
+        if (write && replay.error.empty())
+            write_position(replay.st, result);
+        while (replay.next())
+        {
+            if (write)
+                write_position(replay.st, result);
+        }
+        plies += replay.ply;
+        if (!replay.error.empty())
+        {
+            ++errors;
+            cerr << "Game " << games << ": " << replay.error << endl;
+        }
+    }
+    const double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Games: " << games << ", with errors: " << errors << endl;
+    cout << "Moves: " << plies << endl;
+    if (out.is_open())
+        cout << "Positions written: " << positions << endl;
+    cout << "Time (ms): " << int(sec * 1000) << ", games/minute: " << size_t(games / max(sec, 1e-9) * 60) << endl;
+    return errors ? 2 : 0;
+}
@@ -0,0 +1,10 @@
+#include "../Game/Server.h"
+
+//     Unix- ( "Server"  settings.json):
+//  JSON lines          .
+int main(int argc, char* argv[])
+{
+    Config config;
+    Server server(&config);
+    return server.run();
+}
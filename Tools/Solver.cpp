@@ -0,0 +1,229 @@
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../Engine/Bench_positions.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Notation.h"
+
+//   :        
+//      ( 1, 2, ...)   
+//      .  ,    
+//   .   -       ,
+//          .
+//    ,      Logic.
+class Solver
+{
+public:
+    Solver(const int max_level, const int time_ms, const BotScoringType scoring)
+        : max_level(max_level), time_limit(time_ms)
+    {
+        settings.no_random = true;
+        settings.weights_path.clear();
+        settings.scoring_type = scoring;
+    }
+
+    //  load      path.
+    //  : 32   (  Training_data),   (w  b),
+    //     ("22-18"  "15x22x29")    .
+    //    ,   '#', .  false  .
+    bool load(const string& path)
+    {
+        ifstream fin(path);
+        if (!fin)
+        {
+            cerr << "Cannot open " << path << endl;
+            return false;
+        }
+        string line;
+        int line_num = 0;
+        while (getline(fin, line))
+        {
+            ++line_num;
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (line.empty() || line[0] == '#')
+                continue;
+            istringstream in(line);
+            test_position pos;
+            string cells, color, moves;
+            in >> cells >> color >> moves;
+            getline(in >> ws, pos.name);
+            bool valid = cells.size() == 32 && (color == "w" || color == "b") && !moves.empty();
+            for (const char c : cells)
+                valid = valid && c >= '0' && c <= '4';
+            if (valid)
+            {
+                pos.cells = cells;
+                pos.color = (color == "b");
+                stringstream move_list(moves);
+                string move;
+                while (getline(move_list, move, ','))
+                {
+                    pos.best.push_back(Notation::parse_squares(move));
+                    valid = valid && !pos.best.back().empty();
+                }
+            }
+            if (!valid)
+            {
+                cerr << path << ":" << line_num << ": invalid position" << endl;
+                return false;
+            }
+            if (pos.name.empty())
+                pos.name = "#" + to_string(positions.size() + 1);
+            positions.push_back(pos);
+        }
+        results.resize(positions.size());
+        return true;
+    }
+
+    //  run     threads_num    
+    void run(unsigned threads_num)
+    {
+        if (threads_num == 0)
+            threads_num = max(1u, thread::hardware_concurrency());
+        threads_num = min<unsigned>(threads_num, max<size_t>(1, positions.size()));
+        vector<thread> workers;
+        for (unsigned i = 0; i < threads_num; ++i)
+            workers.emplace_back(&Solver::worker, this);
+        for (auto& th : workers)
+            th.join();
+
+        int solved = 0;
+        double total_ms = 0;
+        size_t total_nodes = 0;
+        for (const auto& res : results)
+        {
+            total_nodes += res.nodes;
+            if (res.solved)
+            {
+                ++solved;
+                total_ms += res.solve_ms;
+            }
+        }
+        cout << "Solved " << solved << " of " << positions.size() << endl;
+        if (solved)
+            cout << "Average time to solution (ms): " << fixed << setprecision(1) << total_ms / solved << endl;
+        cout << "Nodes searched: " << total_nodes << endl;
+    }
+
+private:
+    //  : ,  ,   ( )  
+    struct test_position
+    {
+        string cells;
+        bool color;
+        vector<vector<int>> best;
+        string name;
+    };
+
+    //  :   ,    ,     ,
+    //       
+    struct test_result
+    {
+        bool solved = false;
+        double solve_ms = 0;
+        int solve_level = 0;
+        int last_level = 0;
+        string found;
+        size_t nodes = 0;
+    };
+
+    //  worker -   :      .
+    //       Logic:    
+    //     ,       ,
+    //      .
+    void worker()
+    {
+        size_t index;
+        while ((index = next_position++) < positions.size())
+        {
+            Logic logic(settings);
+            results[index] = solve(logic, positions[index]);
+            print(index);
+        }
+    }
+
+    //  solve     pos   
+    test_result solve(Logic& logic, const test_position& pos) const
+    {
+        test_result res;
+        const auto mtx = bench_position{ pos.cells.c_str(), pos.color }.to_matrix();
+        const auto start = chrono::steady_clock::now();
+        logic.deadline = time_limit > 0 ? start + chrono::milliseconds(time_limit) : chrono::steady_clock::time_point::max();
+        logic.nodes = 0;
+        for (int level = 1; level <= max_level; ++level)
+        {
+            logic.Max_depth = level;
+            const auto turn = logic.find_best_turns(mtx, pos.color);
+            //     
+            if (logic.aborted)
+                break;
+            const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            const bool correct = find(pos.best.begin(), pos.best.end(), Notation::turn_squares(turn)) != pos.best.end();
+            if (correct && !res.solved)
+            {
+                res.solve_ms = ms;
+                res.solve_level = level;
+            }
+            res.solved = correct;
+            res.last_level = level;
+            res.found = Notation::turn_to_string(turn);
+            if (time_limit > 0 && ms >= time_limit)
+                break;
+        }
+        res.nodes = logic.nodes;
+        return res;
+    }
+
+    //  print    index
+    void print(const size_t index)
+    {
+        const auto& res = results[index];
+        lock_guard<mutex> lock(output_guard);
+        cout << left << setw(12) << positions[index].name << right;
+        if (res.solved)
+            cout << " solved  " << setw(10) << res.found << "  level " << setw(2) << res.solve_level << ", " << fixed
+                 << setprecision(1) << setw(9) << res.solve_ms << " ms";
+        else
+            cout << " failed  " << setw(10) << res.found << "  level " << setw(2) << res.last_level;
+        cout << ", " << res.nodes << " nodes" << endl;
+    }
+
+private:
+    engine_settings settings;
+    int max_level;
+    int time_limit;
+
+    vector<test_position> positions;
+    vector<test_result> results;
+    atomic<size_t> next_position{ 0 };
+    mutex output_guard;
+};
+
+// : Solver < > [ =10] [  , =1000 (0 -  )]
+// [ =0 (  )] [ ]
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        cerr << "Usage: Solver <suite file> [max level] [time per position, ms] [threads] [scoring]" << endl;
+        return 1;
+    }
+    const int max_level = argc > 2 ? stoi(argv[2]) : 10;
+    const int time_ms = argc > 3 ? stoi(argv[3]) : 1000;
+    const unsigned threads = argc > 4 ? stoul(argv[4]) : 0;
+    const BotScoringType scoring = argc > 5 ? parse_scoring_type(argv[5]) : BotScoringType::NumberAndPotential;
+
+    Solver solver(max_level, time_ms, scoring);
+    if (!solver.load(argv[1]))
+        return 1;
+    solver.run(threads);
+    return 0;
+}
@@ -0,0 +1,10 @@
+#include "../Game/Tuner.h"
+
+//   :      (    "Tuner"),
+//              .
+int main(int argc, char* argv[])
+{
+    Config config;
+    Tuner tuner(&config);
+    return tuner.run();
+}
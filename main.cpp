@@ -4,5 +4,6 @@ int main(int argc, char* argv[])
 {
     Game g;
     g.play();
+    TRACE_DUMP(project_path + "trace.json");
     return 0;
 }
\ No newline at end of file